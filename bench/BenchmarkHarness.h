@@ -0,0 +1,108 @@
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <StandardDefines.h>
+#include <atomic>
+#include <cstdio>
+
+#ifdef ARDUINO
+    #include <Arduino.h>
+    #define bench_print(x) Serial.print(x)
+#else
+    #include <chrono>
+    #include <iostream>
+    #define bench_print(x) std::cout << x
+#endif
+
+/**
+ * Minimal timing / allocation counting harness for the benchmarks in this directory.
+ * Runs on desktop (steady_clock) and on Arduino targets (micros()).
+ *
+ * Allocations are counted by the replacement operator new defined in exactly one
+ * translation unit (RouteBenchmark.cpp), through BenchmarkAllocationCount().
+ */
+
+/**
+ * Global allocation counter bumped by the replacement operator new
+ */
+inline std::atomic<Size>& BenchmarkAllocationCount() {
+    static std::atomic<Size> count(0);
+    return count;
+}
+
+/**
+ * Keep a value alive so the optimizer cannot drop the benchmarked work
+ */
+template<typename T>
+inline Void BenchmarkKeep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const Void* sink;
+    sink = &value;
+#endif
+}
+
+struct BenchmarkResult {
+    CChar* name;
+    Size iterations;
+    double nsPerOp;
+    double allocationsPerOp;
+};
+
+class BenchmarkHarness {
+    Private
+        Static UInt64 NowNs() {
+#ifdef ARDUINO
+            return static_cast<UInt64>(micros()) * 1000ULL;
+#else
+            return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+    Public
+        /**
+         * Time body(i) for i in [0, iterations) after a short warm-up
+         *
+         * @param name Label printed with the result
+         * @param iterations Number of measured calls
+         * @param body Callable taking the iteration index
+         */
+        template<typename Body>
+        Static BenchmarkResult Run(CChar* name, Size iterations, Body&& body) {
+            Size warmup = iterations / 10;
+            for (Size i = 0; i < warmup; i++) {
+                body(i);
+            }
+
+            Size allocationsBefore = BenchmarkAllocationCount().load(std::memory_order_relaxed);
+            UInt64 start = NowNs();
+            for (Size i = 0; i < iterations; i++) {
+                body(i);
+            }
+            UInt64 elapsed = NowNs() - start;
+            Size allocations = BenchmarkAllocationCount().load(std::memory_order_relaxed) - allocationsBefore;
+
+            BenchmarkResult result{name, iterations,
+                                   static_cast<double>(elapsed) / static_cast<double>(iterations),
+                                   static_cast<double>(allocations) / static_cast<double>(iterations)};
+            Print(result);
+            return result;
+        }
+
+        Static Void PrintHeader(CChar* title) {
+            bench_print("\n== ");
+            bench_print(title);
+            bench_print(" ==\n");
+        }
+
+        Static Void Print(const BenchmarkResult& result) {
+            Char line[128];
+            snprintf(line, sizeof(line), "  %-40s %12.1f ns/op %8.2f allocs/op\n",
+                     result.name, result.nsPerOp, result.allocationsPerOp);
+            bench_print(line);
+        }
+};
+
+#endif // BENCHMARK_HARNESS_H
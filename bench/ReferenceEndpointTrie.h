@@ -0,0 +1,169 @@
+#ifndef REFERENCE_ENDPOINT_TRIE_H
+#define REFERENCE_ENDPOINT_TRIE_H
+
+#include <StandardDefines.h>
+#include "HttpRoute.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * Result of a ReferenceEndpointTrie search
+ */
+struct ReferenceMatch {
+    StdString pattern;
+    StdMap<StdString, StdString> variables;
+    const HttpRoute* route;
+    Bool found;
+    Bool methodMismatch;
+
+    ReferenceMatch() : route(nullptr), found(false), methodMismatch(false) {}
+};
+
+/**
+ * The string-based route matcher EndpointTrie replaced, kept as the oracle for the
+ * differential check in RouteVerification.h
+ *
+ * Same algorithm as before the allocation-free rewrite: the path is split into StdString
+ * segments, variables are collected in a map, and the search backtracks depth first,
+ * literal child before the variable children (in name order). Slow on purpose; do not
+ * use it outside of the verification.
+ */
+class ReferenceEndpointTrie {
+    struct Node {
+        StdMap<StdString, std::unique_ptr<Node>> literalChildren;
+        StdMap<StdString, std::unique_ptr<Node>> variableChildren;  // Keyed by variable name
+        StdString pattern;
+        Bool isEndpoint = false;
+        const HttpRoute* routes[HttpMethodCount] = {};
+    };
+
+    Private Node root;
+
+    // Method index meaning "any method" (pattern-only search)
+    Private Static constexpr Size AnyMethod = HttpMethodCount;
+
+    Public Void Insert(const HttpRoute& route) {
+        StdString pattern(route.pattern);
+        Node* current = &root;
+        for (CStdString& segment : SplitPath(pattern)) {
+            Bool variable = segment.length() >= 2 && segment.front() == '{' && segment.back() == '}';
+            auto& children = variable ? current->variableChildren : current->literalChildren;
+            std::unique_ptr<Node>& child = children[variable ? segment.substr(1, segment.length() - 2) : segment];
+            if (child == nullptr) {
+                child.reset(new Node());
+            }
+            current = child.get();
+        }
+        current->pattern = pattern;
+        current->isEndpoint = true;
+        current->routes[HttpMethodIndex(route.method)] = &route;
+    }
+
+    /**
+     * @brief Pattern-only search (any method)
+     */
+    Public ReferenceMatch Search(CStdString& path) const {
+        StdMap<StdString, StdString> variables;
+        Bool methodMismatch = false;
+        return SearchRecursive(root, SplitPath(path), 0, variables, AnyMethod, methodMismatch);
+    }
+
+    /**
+     * @brief Method-aware search; methodMismatch is set when only other methods matched
+     */
+    Public ReferenceMatch Search(CStdString& path, HttpMethod method) const {
+        StdMap<StdString, StdString> variables;
+        Bool methodMismatch = false;
+        ReferenceMatch result = SearchRecursive(root, SplitPath(path), 0, variables, HttpMethodIndex(method), methodMismatch);
+        if (!result.found) {
+            result.methodMismatch = methodMismatch;
+        }
+        return result;
+    }
+
+    /**
+     * "/api/user/123/" -> ["api", "user", "123", ""]: empty segments from "//" are dropped,
+     * a trailing slash becomes a final empty segment
+     */
+    Private Static StdVector<StdString> SplitPath(CStdString& path) {
+        StdVector<StdString> segments;
+        if (path.empty() || path == "/") {
+            return segments;
+        }
+        StdString current = path[0] == '/' ? path.substr(1) : path;
+        CBool trailingSlash = !current.empty() && current.back() == '/';
+        if (trailingSlash) {
+            current.pop_back();
+        }
+        Size start = 0;
+        while (start <= current.length()) {
+            Size end = current.find('/', start);
+            if (end == StdString::npos) {
+                end = current.length();
+            }
+            if (end > start) {
+                segments.push_back(current.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+        if (trailingSlash) {
+            segments.push_back("");
+        }
+        return segments;
+    }
+
+    Private Static ReferenceMatch MatchEndpoint(const Node& node, const StdMap<StdString, StdString>& variables,
+                                                CSize methodIndex, Bool& methodMismatch) {
+        ReferenceMatch result;
+        if (!node.isEndpoint) {
+            return result;
+        }
+        if (methodIndex != AnyMethod) {
+            result.route = node.routes[methodIndex];
+            if (result.route == nullptr) {
+                methodMismatch = true;
+                return result;
+            }
+        }
+        result.pattern = node.pattern;
+        result.variables = variables;
+        result.found = true;
+        return result;
+    }
+
+    Private Static ReferenceMatch SearchRecursive(const Node& node, const StdVector<StdString>& segments, CSize index,
+                                                  StdMap<StdString, StdString>& variables, CSize methodIndex, Bool& methodMismatch) {
+        if (index >= segments.size()) {
+            return MatchEndpoint(node, variables, methodIndex, methodMismatch);
+        }
+        CStdString& segment = segments[index];
+
+        // A trailing slash only matches the endpoint reached so far, and only when no
+        // variable was consumed: "/xyz/" matches "/xyz", "/user/1/" does not match "/user/{id}"
+        if (segment.empty() && index + 1 >= segments.size()) {
+            return variables.empty() ? MatchEndpoint(node, variables, methodIndex, methodMismatch) : ReferenceMatch();
+        }
+
+        if (!segment.empty()) {
+            auto literal = node.literalChildren.find(segment);
+            if (literal != node.literalChildren.end()) {
+                ReferenceMatch result = SearchRecursive(*literal->second, segments, index + 1, variables, methodIndex, methodMismatch);
+                if (result.found) {
+                    return result;
+                }
+            }
+        }
+        for (const auto& variable : node.variableChildren) {
+            variables[variable.first] = segment;
+            ReferenceMatch result = SearchRecursive(*variable.second, segments, index + 1, variables, methodIndex, methodMismatch);
+            if (result.found) {
+                return result;
+            }
+            variables.erase(variable.first);
+        }
+        return ReferenceMatch();
+    }
+};
+
+#endif // REFERENCE_ENDPOINT_TRIE_H
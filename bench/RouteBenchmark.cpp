@@ -0,0 +1,300 @@
+/**
+ * Route matching, dispatch and response conversion benchmarks
+ *
+ * Desktop:  cmake -S . -B build -DSPRINGBOOTPLUSPLUS_WEB_BUILD_BENCH=ON
+ *           cmake --build build --target springbootplusplus_web_bench && ./build/springbootplusplus_web_bench
+ * Device:   cd bench && pio run -t upload -t monitor   (reduced route count and iterations)
+ *
+ * Reports ns/op and heap allocations/op for:
+ *   - EndpointTrie::Search (map based result), EndpointTrie::Match, CompiledEndpointTrie::Match,
+ *     LiteralRouteTable::Find (perfect hash of the literal routes)
+ *   - HttpRequestDispatcher::Dispatch (match + variables + handler call)
+ *   - HttpRequestDispatcher::TryConvertToType (path variable parsing and URL decoding)
+ *   - ResponseEntityConverter::ToHttpResponse, HttpResponseWriter::Write vs ToHttpString
+ * over literal-heavy, variable-heavy, deep, trailing-slash and 404 route sets.
+ *
+ * Verify:   ./build/springbootplusplus_web_bench --verify [seed]
+ *           randomized differential check of the route matchers (RouteVerification.h);
+ *           exits non-zero on a mismatch. Device builds run it with seed 1 before the benchmarks.
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include "BenchmarkHarness.h"
+#include "SyntheticRoutes.h"
+#include "RouteVerification.h"
+#include "EndpointTrie.h"
+#include "CompiledEndpointTrie.h"
+#include "LiteralRouteTable.h"
+#include "HttpRequestDispatcher.h"
+#include "ResponseEntityToHttpResponse.h"
+#include "HttpResponseWriter.h"
+
+#ifndef BENCH_ROUTE_COUNT
+    #ifdef ARDUINO
+        #define BENCH_ROUTE_COUNT 32
+    #else
+        #define BENCH_ROUTE_COUNT 128
+    #endif
+#endif
+
+#ifndef BENCH_VERIFY_ROUNDS
+    #ifdef ARDUINO
+        #define BENCH_VERIFY_ROUNDS 20
+    #else
+        #define BENCH_VERIFY_ROUNDS 2000
+    #endif
+#endif
+
+#ifndef BENCH_ITERATIONS
+    #ifdef ARDUINO
+        #define BENCH_ITERATIONS 2000
+    #else
+        #define BENCH_ITERATIONS 200000
+    #endif
+#endif
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+// The replacements allocate with malloc/free. Kept out of line so the compiler never sees
+// free() applied to the result of operator new at an inlined call site
+// (-Wmismatched-new-delete); over-aligned new/delete keep the default pair
+#if defined(_MSC_VER)
+    #define BENCH_NOINLINE __declspec(noinline)
+#else
+    #define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+BENCH_NOINLINE void* operator new(std::size_t size) {
+    BenchmarkAllocationCount().fetch_add(1, std::memory_order_relaxed);
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        std::abort();
+    }
+    return memory;
+}
+
+BENCH_NOINLINE void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+BENCH_NOINLINE void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    BenchmarkAllocationCount().fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+BENCH_NOINLINE void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+BENCH_NOINLINE void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+BENCH_NOINLINE void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+BENCH_NOINLINE void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+BENCH_NOINLINE void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+BENCH_NOINLINE void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+BENCH_NOINLINE void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+/**
+ * Handler shared by every synthetic route: returns a prebuilt response so dispatch
+ * numbers measure routing, not response construction
+ */
+static IHttpResponsePtr BenchHandler(const HttpRequestContext& context) {
+    static IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(
+        ResponseEntity<StdString>::Ok("ok"));
+    BenchmarkKeep(context.GetBodyView());
+    BenchmarkKeep(context.GetPathVariable("id"));
+    return response;
+}
+
+static Void BenchRouteSet(const SyntheticRouteSet& set) {
+    BenchmarkHarness::PrintHeader(set.name);
+
+    EndpointTrie trie;
+    for (const HttpRoute& route : set.routes) {
+        trie.Insert(route);
+    }
+    CompiledEndpointTrie compiled;
+    compiled.Compile(trie);
+    LiteralRouteTable literal;
+    literal.Build({{set.routes.data(), set.routes.size()}});
+
+    HttpRequestDispatcher dispatcher;
+    dispatcher.RegisterRoutes(set.routes.data(), set.routes.size());
+
+    const StdVector<StdString>& hits = set.hits;
+    const StdVector<StdString>& misses = set.misses;
+    CStdString body = "{\"name\":\"bench\"}";
+    CStdString requestId = "bench-connection";
+    CStdString ifNoneMatch = "";
+
+    Char memory[96];
+    snprintf(memory, sizeof(memory), "  %u routes, compiled layout %u nodes / %u bytes\n",
+             static_cast<unsigned>(set.routes.size()),
+             static_cast<unsigned>(compiled.GetNodeCount()),
+             static_cast<unsigned>(compiled.GetMemoryUsage()));
+    bench_print(memory);
+
+    BenchmarkHarness::Run("EndpointTrie::Search hit", BENCH_ITERATIONS, [&](Size i) {
+        EndpointMatchResult result = trie.Search(hits[i % hits.size()], HttpMethod::GET);
+        BenchmarkKeep(result);
+    });
+    BenchmarkHarness::Run("EndpointTrie::Match hit", BENCH_ITERATIONS, [&](Size i) {
+        EndpointMatch result = trie.Match(hits[i % hits.size()], HttpMethod::GET);
+        BenchmarkKeep(result);
+    });
+    BenchmarkHarness::Run("CompiledEndpointTrie::Match hit", BENCH_ITERATIONS, [&](Size i) {
+        EndpointMatch result = compiled.Match(hits[i % hits.size()], HttpMethod::GET);
+        BenchmarkKeep(result);
+    });
+    BenchmarkHarness::Run("CompiledEndpointTrie::Match 404", BENCH_ITERATIONS, [&](Size i) {
+        EndpointMatch result = compiled.Match(misses[i % misses.size()], HttpMethod::GET);
+        BenchmarkKeep(result);
+    });
+    BenchmarkHarness::Run("LiteralRouteTable::Find hit", BENCH_ITERATIONS, [&](Size i) {
+        const HttpRoute* route = literal.Find(HttpMethod::GET, hits[i % hits.size()]);
+        BenchmarkKeep(route);
+    });
+    BenchmarkHarness::Run("Dispatch hit", BENCH_ITERATIONS, [&](Size i) {
+        IHttpResponsePtr response = dispatcher.Dispatch(HttpMethod::GET, hits[i % hits.size()], body, requestId, ifNoneMatch);
+        BenchmarkKeep(response);
+    });
+    BenchmarkHarness::Run("Dispatch 404", BENCH_ITERATIONS / 10, [&](Size i) {
+        IHttpResponsePtr response = dispatcher.Dispatch(HttpMethod::GET, misses[i % misses.size()], body, requestId, ifNoneMatch);
+        BenchmarkKeep(response);
+    });
+}
+
+static Void BenchResponseConversion() {
+    BenchmarkHarness::PrintHeader("response conversion");
+
+    CStdString requestId = "bench-connection";
+    CStdString smallBody = "{\"status\":\"ok\"}";
+    CStdString largeBody(2048, 'x');
+    StdMap<StdString, StdString> headers{{"Content-Type", "application/json"}, {"Cache-Control", "no-cache"}};
+
+    BenchmarkHarness::Run("ToHttpResponse small body", BENCH_ITERATIONS / 10, [&](Size) {
+        IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(
+            requestId, ResponseEntity<StdString>::Ok(smallBody));
+        BenchmarkKeep(response);
+    });
+    BenchmarkHarness::Run("ToHttpResponse 2 KiB body + headers", BENCH_ITERATIONS / 10, [&](Size) {
+        IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(
+            requestId, ResponseEntity<StdString>::Ok(largeBody, headers));
+        BenchmarkKeep(response);
+    });
+
+    IHttpResponsePtr largeResponse = ResponseEntityConverter::ToHttpResponse<StdString>(
+        requestId, ResponseEntity<StdString>::Ok(largeBody, headers));
+    HttpResponseWriter writer;
+    BenchmarkHarness::Run("HttpResponseWriter::Write 2 KiB", BENCH_ITERATIONS / 10, [&](Size) {
+        BenchmarkKeep(writer.Write(*largeResponse));
+        writer.Reset();
+    });
+    BenchmarkHarness::Run("IHttpResponse::ToHttpString 2 KiB", BENCH_ITERATIONS / 10, [&](Size) {
+        StdString wire = largeResponse->ToHttpString();
+        BenchmarkKeep(wire);
+    });
+}
+
+static Void BenchPathVariableConversion() {
+    BenchmarkHarness::PrintHeader("path variable conversion");
+
+    BenchmarkHarness::Run("TryConvertToType<Int>", BENCH_ITERATIONS, [&](Size) {
+        Int value = 0;
+        BenchmarkKeep(HttpRequestDispatcher::TryConvertToType<Int>("123456", value));
+        BenchmarkKeep(value);
+    });
+    BenchmarkHarness::Run("TryConvertToType<double>", BENCH_ITERATIONS, [&](Size) {
+        double value = 0;
+        BenchmarkKeep(HttpRequestDispatcher::TryConvertToType<double>("3.14159", value));
+        BenchmarkKeep(value);
+    });
+    BenchmarkHarness::Run("TryConvertToType<Bool>", BENCH_ITERATIONS, [&](Size) {
+        Bool value = false;
+        BenchmarkKeep(HttpRequestDispatcher::TryConvertToType<Bool>("True", value));
+        BenchmarkKeep(value);
+    });
+    BenchmarkHarness::Run("TryConvertToType<StdString> plain", BENCH_ITERATIONS, [&](Size) {
+        StdString value;
+        BenchmarkKeep(HttpRequestDispatcher::TryConvertToType<StdString>("living-room-sensor", value));
+        BenchmarkKeep(value);
+    });
+    BenchmarkHarness::Run("TryConvertToType<StdString> escaped", BENCH_ITERATIONS, [&](Size) {
+        StdString value;
+        BenchmarkKeep(HttpRequestDispatcher::TryConvertToType<StdString>("living%20room%2Fsensor+1", value));
+        BenchmarkKeep(value);
+    });
+}
+
+/**
+ * Differential check of EndpointTrie against the reference matcher and of
+ * CompiledEndpointTrie against EndpointTrie
+ */
+static Size VerifyRouteMatchers(CUInt seed) {
+    BenchmarkHarness::PrintHeader("route matcher verification");
+    Char line[64];
+    snprintf(line, sizeof(line), "  seed %u, %u rounds\n", seed, static_cast<unsigned>(BENCH_VERIFY_ROUNDS));
+    bench_print(line);
+    return RouteVerification(seed).Run(BENCH_VERIFY_ROUNDS);
+}
+
+static Void RunAllBenchmarks() {
+    BenchRouteSet(SyntheticRoutes::LiteralHeavy(BENCH_ROUTE_COUNT, &BenchHandler));
+    BenchRouteSet(SyntheticRoutes::VariableHeavy(BENCH_ROUTE_COUNT, &BenchHandler));
+    BenchRouteSet(SyntheticRoutes::DeepPaths(BENCH_ROUTE_COUNT, &BenchHandler));
+    BenchRouteSet(SyntheticRoutes::TrailingSlashes(BENCH_ROUTE_COUNT, &BenchHandler));
+    BenchRouteSet(SyntheticRoutes::Overlapping(BENCH_ROUTE_COUNT, &BenchHandler));
+    BenchPathVariableConversion();
+    BenchResponseConversion();
+}
+
+#ifdef ARDUINO
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+    VerifyRouteMatchers(1);
+    RunAllBenchmarks();
+    bench_print("\nbenchmarks done\n");
+}
+
+void loop() {
+    delay(1000);
+}
+
+#else
+
+int main(int argc, char** argv) {
+    if (argc > 1 && StdString(argv[1]) == "--verify") {
+        CUInt seed = argc > 2 ? static_cast<UInt>(std::strtoul(argv[2], nullptr, 10)) : 1;
+        return VerifyRouteMatchers(seed) == 0 ? 0 : 1;
+    }
+    RunAllBenchmarks();
+    return 0;
+}
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef ROUTE_VERIFICATION_H
+#define ROUTE_VERIFICATION_H
+
+#include <StandardDefines.h>
+#include "BenchmarkHarness.h"
+#include "ReferenceEndpointTrie.h"
+#include "EndpointTrie.h"
+#include "CompiledEndpointTrie.h"
+#include <deque>
+#include <random>
+
+/**
+ * Randomized differential check of the route matchers (bench --verify [seed])
+ *
+ * Each round registers a random route set (literal, variable and trailing-slash patterns
+ * over a small alphabet, so patterns overlap heavily) and matches random paths against:
+ *   - EndpointTrie vs ReferenceEndpointTrie, the string-based matcher it replaced
+ *   - CompiledEndpointTrie vs EndpointTrie
+ * for every method and for the pattern-only search. Found/404/405, route, pattern and
+ * variables (captures for the compiled trie) must agree.
+ *
+ * Variables are named after their depth ({v0}, {v1}, ...): sibling variables then always
+ * share a name, where the compiled trie (specificity order) and the backtracking tries
+ * (name order) are allowed to differ by design.
+ */
+class RouteVerification {
+    Private std::mt19937 random;
+    Private Size checks;
+    Private Size mismatches;
+
+    Private Static constexpr Size MaxReports = 5;
+
+    Public explicit RouteVerification(CUInt seed) : random(seed), checks(0), mismatches(0) {
+    }
+
+    /**
+     * @brief Run the check
+     * @param rounds Number of random route sets
+     * @return Number of mismatches (0 = matchers agree)
+     */
+    Public Size Run(CSize rounds) {
+        for (Size round = 0; round < rounds; round++) {
+            RunRound();
+        }
+        Char line[96];
+        snprintf(line, sizeof(line), "  %u checks, %u mismatches\n",
+                 static_cast<unsigned>(checks), static_cast<unsigned>(mismatches));
+        bench_print(line);
+        return mismatches;
+    }
+
+    Private Static constexpr HttpMethod Methods[] = {HttpMethod::GET, HttpMethod::POST, HttpMethod::PUT};
+
+    Private Size Pick(CSize count) {
+        return static_cast<Size>(random() % count);
+    }
+
+    Private StdString RandomPattern() {
+        StdString pattern;
+        CSize depth = Pick(5);
+        for (Size i = 0; i < depth; i++) {
+            CSize kind = Pick(3);
+            pattern += kind == 0 ? "/a" : kind == 1 ? "/b" : "/{v" + std::to_string(i) + "}";
+        }
+        if (pattern.empty()) {
+            pattern = "/";
+        }
+        if (Pick(10) == 0) {
+            pattern += "/";
+        }
+        return pattern;
+    }
+
+    Private StdString RandomPath() {
+        static CChar* const segments[] = {"a", "b", "c", "x1"};
+        StdString path;
+        CSize depth = Pick(6);
+        for (Size i = 0; i < depth; i++) {
+            path += Pick(8) == 0 ? "//" : "/";
+            path += segments[Pick(4)];
+        }
+        if (Pick(4) == 0) {
+            path += "/";
+        }
+        return path;
+    }
+
+    Private Void RunRound() {
+        std::deque<StdString> patterns;
+        StdVector<HttpRoute> routes;
+        CSize routeCount = 1 + Pick(25);
+        routes.reserve(routeCount);
+        for (Size i = 0; i < routeCount; i++) {
+            patterns.push_back(RandomPattern());
+            HttpRoute route;
+            route.method = Methods[Pick(3)];
+            route.pattern = patterns.back().c_str();
+            routes.push_back(route);
+        }
+
+        ReferenceEndpointTrie reference;
+        EndpointTrie trie;
+        for (const HttpRoute& route : routes) {
+            reference.Insert(route);
+            trie.Insert(route);
+        }
+        CompiledEndpointTrie compiled;
+        compiled.Compile(trie);
+
+        for (Size query = 0; query < 60; query++) {
+            CStdString path = RandomPath();
+            for (HttpMethod method : Methods) {
+                EndpointMatch match = trie.Match(path, method);
+                Expect(SameAsReference(reference.Search(path, method), match, path), "EndpointTrie vs reference", path, routes);
+                Expect(SameMatch(match, compiled.Match(path, method)), "CompiledEndpointTrie vs EndpointTrie", path, routes);
+            }
+            EndpointMatchResult any = trie.Search(path);
+            ReferenceMatch referenceAny = reference.Search(path);
+            Expect(any.found == referenceAny.found && any.pattern == referenceAny.pattern && any.variables == referenceAny.variables,
+                   "EndpointTrie vs reference (any method)", path, routes);
+            EndpointMatch compiledAny = compiled.Match(path);
+            Expect(any.found == compiledAny.found && (!any.found || (any.pattern == compiledAny.pattern && any.variables == compiledAny.ToVariables(path))),
+                   "CompiledEndpointTrie vs EndpointTrie (any method)", path, routes);
+        }
+    }
+
+    Private Static Bool SameAsReference(const ReferenceMatch& expected, const EndpointMatch& actual, CStdString& path) {
+        if (expected.found != actual.found) {
+            return false;
+        }
+        if (!expected.found) {
+            return expected.methodMismatch == actual.methodMismatch;
+        }
+        return expected.route == actual.route && expected.pattern == actual.pattern &&
+               expected.variables == actual.ToVariables(path);
+    }
+
+    Private Static Bool SameMatch(const EndpointMatch& expected, const EndpointMatch& actual) {
+        if (expected.found != actual.found) {
+            return false;
+        }
+        if (!expected.found) {
+            return expected.methodMismatch == actual.methodMismatch;
+        }
+        if (expected.route != actual.route || expected.pattern != actual.pattern || expected.captureCount != actual.captureCount) {
+            return false;
+        }
+        for (Size i = 0; i < expected.captureCount; i++) {
+            if (expected.captures[i].name != actual.captures[i].name || expected.captures[i].offset != actual.captures[i].offset ||
+                expected.captures[i].length != actual.captures[i].length) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Private Void Expect(CBool agree, CChar* check, CStdString& path, const StdVector<HttpRoute>& routes) {
+        checks++;
+        if (agree) {
+            return;
+        }
+        if (mismatches++ >= MaxReports) {
+            return;
+        }
+        bench_print("  MISMATCH ");
+        bench_print(check);
+        bench_print(": path \"");
+        bench_print(path.c_str());
+        bench_print("\", routes");
+        for (const HttpRoute& route : routes) {
+            bench_print(" ");
+            bench_print(HttpMethodIndex(route.method));
+            bench_print(":");
+            bench_print(route.pattern);
+        }
+        bench_print("\n");
+    }
+};
+
+#endif // ROUTE_VERIFICATION_H
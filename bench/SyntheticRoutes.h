@@ -0,0 +1,124 @@
+#ifndef SYNTHETIC_ROUTES_H
+#define SYNTHETIC_ROUTES_H
+
+#include <StandardDefines.h>
+#include "HttpRoute.h"
+#include <deque>
+
+/**
+ * Generated route set plus the lookups to run against it
+ *
+ * Patterns are kept in a deque so the CChar* stored in each HttpRoute stays valid while
+ * more patterns are added.
+ */
+struct SyntheticRouteSet {
+    CChar* name;
+    std::deque<StdString> patterns;
+    StdVector<HttpRoute> routes;
+    StdVector<StdString> hits;    // Paths that resolve to a GET route
+    StdVector<StdString> misses;  // Paths that resolve to nothing (404)
+
+    Void Add(HttpMethod method, const StdString& pattern, HttpRouteHandler handler) {
+        patterns.push_back(pattern);
+        routes.push_back(HttpRoute{method, patterns.back().c_str(), handler});
+    }
+};
+
+/**
+ * Builders for the route shapes we care about. Every set registers count GET routes and
+ * a POST twin for every fourth pattern, so per-method slots are exercised as well.
+ */
+class SyntheticRoutes {
+    Private
+        Static StdString Number(Size value) {
+            return std::to_string(value);
+        }
+
+        Static Void AddWithTwin(SyntheticRouteSet& set, Size i, const StdString& pattern, HttpRouteHandler handler) {
+            set.Add(HttpMethod::GET, pattern, handler);
+            if (i % 4 == 0) {
+                set.Add(HttpMethod::POST, pattern, handler);
+            }
+        }
+
+    Public
+        /**
+         * /api/v1/res<i>/items : only literal segments
+         */
+        Static SyntheticRouteSet LiteralHeavy(Size count, HttpRouteHandler handler) {
+            SyntheticRouteSet set;
+            set.name = "literal-heavy";
+            for (Size i = 0; i < count; i++) {
+                AddWithTwin(set, i, "/api/v1/res" + Number(i) + "/items", handler);
+                set.hits.push_back("/api/v1/res" + Number(i) + "/items");
+            }
+            for (Size i = 0; i < count; i++) {
+                set.misses.push_back("/api/v1/res" + Number(i) + "/missing");
+            }
+            return set;
+        }
+
+        /**
+         * /api/r<i>/{id}/{sub}/{leaf} : three captures per route
+         */
+        Static SyntheticRouteSet VariableHeavy(Size count, HttpRouteHandler handler) {
+            SyntheticRouteSet set;
+            set.name = "variable-heavy";
+            for (Size i = 0; i < count; i++) {
+                AddWithTwin(set, i, "/api/r" + Number(i) + "/{id}/{sub}/{leaf}", handler);
+                set.hits.push_back("/api/r" + Number(i) + "/" + Number(i * 7) + "/child/leaf" + Number(i));
+            }
+            for (Size i = 0; i < count; i++) {
+                set.misses.push_back("/api/r" + Number(i) + "/" + Number(i) + "/child");
+            }
+            return set;
+        }
+
+        /**
+         * Twelve-segment paths with a variable in the middle
+         */
+        Static SyntheticRouteSet DeepPaths(Size count, HttpRouteHandler handler) {
+            SyntheticRouteSet set;
+            set.name = "deep-paths";
+            for (Size i = 0; i < count; i++) {
+                StdString prefix = "/org/" + Number(i % 8) + "/team/" + Number(i) + "/project/main/service/api";
+                AddWithTwin(set, i, prefix + "/{version}/module/endpoint/detail", handler);
+                set.hits.push_back(prefix + "/v" + Number(i) + "/module/endpoint/detail");
+                set.misses.push_back(prefix + "/v" + Number(i) + "/module/endpoint/other");
+            }
+            return set;
+        }
+
+        /**
+         * Literal routes hit with a trailing slash, variable routes missed with one
+         */
+        Static SyntheticRouteSet TrailingSlashes(Size count, HttpRouteHandler handler) {
+            SyntheticRouteSet set;
+            set.name = "trailing-slashes";
+            for (Size i = 0; i < count; i++) {
+                AddWithTwin(set, i, "/devices/d" + Number(i), handler);
+                AddWithTwin(set, i, "/devices/d" + Number(i) + "/{ssid}", handler);
+                set.hits.push_back("/devices/d" + Number(i) + "/");
+                set.misses.push_back("/devices/d" + Number(i) + "/net" + Number(i) + "/");
+            }
+            return set;
+        }
+
+        /**
+         * Literal and variable routes sharing prefixes, with variables named differently
+         * per route: hits need backtracking out of the literal branch in EndpointTrie
+         */
+        Static SyntheticRouteSet Overlapping(Size count, HttpRouteHandler handler) {
+            SyntheticRouteSet set;
+            set.name = "overlapping";
+            for (Size i = 0; i < count; i++) {
+                AddWithTwin(set, i, "/o/k/k/k/x" + Number(i), handler);
+                AddWithTwin(set, i, "/o/{a" + Number(i % 8) + "}/{b}/{c}/leaf" + Number(i), handler);
+                set.hits.push_back("/o/k/k/k/leaf" + Number(i));
+                set.misses.push_back("/o/k/k/k/none" + Number(i));
+            }
+            return set;
+        }
+};
+
+#endif // SYNTHETIC_ROUTES_H
@@ -163,6 +163,7 @@ def parse_function_signature_advanced(line: str) -> Optional[Dict[str, Any]]:
     - /* @RequestBody */ SomeInputDto inputDto
     - /* @PathVariable("xyz") */ StdString someXyz
     - /* @PathVariable("abc") */ const int abc
+    - /* @RequestParam("page") */ Int page
     
     Args:
         line: Function signature line (e.g., "Void SomeFun(/* @RequestBody */ SomeInputDto inputDto, /* @PathVariable("xyz") */ StdString someXyz)")
@@ -171,8 +172,8 @@ def parse_function_signature_advanced(line: str) -> Optional[Dict[str, Any]]:
         Dictionary with 'return_type', 'function_name', and 'parameters' (list of parameter dicts),
         or None if parsing fails.
         Each parameter dict contains:
-        - 'type': "RequestBody" or "PathVariable"
-        - 'subType': Path variable name (e.g., "xyz") or empty string for RequestBody
+        - 'type': "RequestBody", "PathVariable" or "RequestParam"
+        - 'subType': Path variable or query parameter name (e.g., "xyz"), empty string for RequestBody
         - 'class_name': Parameter type (e.g., "SomeInputDto", "StdString", "const int")
         - 'param_name': Parameter name (e.g., "inputDto", "someXyz")
     """
@@ -311,8 +312,8 @@ def _parse_single_parameter(param_str: str) -> Optional[Dict[str, str]]:
     Returns:
         Dictionary with 'type', 'subType', 'class_name', 'param_name', or None if parsing fails
     """
-    # Pattern to match annotation: /* @RequestBody */ or /* @PathVariable("xyz") */
-    annotation_pattern = re.compile(r'/\*\s*@(RequestBody|PathVariable)\s*(?:\(\s*["\']([^"\']+)["\']\s*\))?\s*\*/')
+    # Pattern to match annotation: /* @RequestBody */, /* @PathVariable("xyz") */ or /* @RequestParam("xyz") */
+    annotation_pattern = re.compile(r'/\*\s*@(RequestBody|PathVariable|RequestParam)\s*(?:\(\s*["\']([^"\']+)["\']\s*\))?\s*\*/')
     
     # Find annotation
     annotation_match = annotation_pattern.search(param_str)
@@ -321,9 +322,9 @@ def _parse_single_parameter(param_str: str) -> Optional[Dict[str, str]]:
     sub_type = ""
     
     if annotation_match:
-        param_type = annotation_match.group(1)  # "RequestBody" or "PathVariable"
+        param_type = annotation_match.group(1)  # "RequestBody", "PathVariable" or "RequestParam"
         if annotation_match.group(2):
-            sub_type = annotation_match.group(2)  # Path variable name (e.g., "xyz")
+            sub_type = annotation_match.group(2)  # Path variable or query parameter name (e.g., "xyz")
         
         # Remove annotation from param_str
         param_str = annotation_pattern.sub('', param_str).strip()
@@ -409,6 +410,10 @@ def _parse_single_parameter(param_str: str) -> Optional[Dict[str, str]]:
         else:
             param_name = "param"
     
+    # @RequestParam without a name reads the query parameter named like the argument
+    if param_type == "RequestParam" and not sub_type:
+        sub_type = param_name
+    
     return {
         'type': param_type,
         'subType': sub_type,
@@ -417,6 +422,75 @@ def _parse_single_parameter(param_str: str) -> Optional[Dict[str, str]]:
     }
 
 
+# find_cacheable_ttl() result for a @Cacheable without a TTL
+CACHE_UNTIL_INVALIDATED = -1
+
+
+def find_cacheable_ttl(lines: List[str], mapping_line: int, function_line: Optional[int]) -> Optional[int]:
+    """
+    Find a @Cacheable annotation belonging to an endpoint.
+    
+    Supported forms, on the line directly above the mapping annotation, on the mapping line
+    itself, or between the mapping annotation and the function signature:
+    - /* @Cacheable */          -> cached until invalidated (returns CACHE_UNTIL_INVALIDATED)
+    - /* @Cacheable(30000) */   -> cached for 30000 ms
+    - /* @Cacheable(0) */       -> returns 0, which the generator rejects with an #error
+    
+    Args:
+        lines: Lines of the file
+        mapping_line: 1-based line number of the mapping annotation
+        function_line: 1-based line number where the function signature starts
+        
+    Returns:
+        TTL in milliseconds, CACHE_UNTIL_INVALIDATED, or None if the endpoint is not cacheable
+    """
+    cacheable_pattern = re.compile(r'/\*\s*@Cacheable\s*(?:\(\s*(\d+)\s*\))?\s*\*/')
+    
+    candidate_lines = []
+    if mapping_line >= 2:
+        candidate_lines.append(mapping_line - 1)
+    last_line = function_line if function_line else mapping_line
+    candidate_lines.extend(range(mapping_line, last_line + 1))
+    
+    for line_num in candidate_lines:
+        if line_num < 1 or line_num > len(lines):
+            continue
+        match = cacheable_pattern.search(lines[line_num - 1])
+        if match:
+            return int(match.group(1)) if match.group(1) else CACHE_UNTIL_INVALIDATED
+    return None
+
+
+def find_no_compression(lines: List[str], mapping_line: int, function_line: Optional[int]) -> bool:
+    """
+    Find a @NoCompression annotation belonging to an endpoint (same placement rules as
+    @Cacheable). Such endpoints are always answered with an uncompressed body, e.g. for
+    payloads that are already compressed or are streamed to clients that cannot decode.
+    
+    Args:
+        lines: Lines of the file
+        mapping_line: 1-based line number of the mapping annotation
+        function_line: 1-based line number where the function signature starts
+        
+    Returns:
+        True if the endpoint opts out of response compression
+    """
+    no_compression_pattern = re.compile(r'/\*\s*@NoCompression\s*\*/')
+    
+    candidate_lines = []
+    if mapping_line >= 2:
+        candidate_lines.append(mapping_line - 1)
+    last_line = function_line if function_line else mapping_line
+    candidate_lines.extend(range(mapping_line, last_line + 1))
+    
+    for line_num in candidate_lines:
+        if line_num < 1 or line_num > len(lines):
+            continue
+        if no_compression_pattern.search(lines[line_num - 1]):
+            return True
+    return False
+
+
 def find_mapping_endpoints(file_path: str, base_url: str, class_name: str, interface_name: str) -> List[Dict[str, Any]]:
     """
     Find all HTTP mapping endpoints (GetMapping, PostMapping, PutMapping, DeleteMapping, PatchMapping) 
@@ -615,6 +689,12 @@ def find_mapping_endpoints(file_path: str, base_url: str, class_name: str, inter
                         # No RequestBody found, use first parameter
                         first_arg_type = function_details['parameters'][0].get('class_name', '')
                 
+                # @Cacheable only applies to GET endpoints
+                cache_ttl_ms = None
+                if http_method == 'GET':
+                    cache_ttl_ms = find_cacheable_ttl(lines, i, function_start_line)
+                no_compression = find_no_compression(lines, i, function_start_line)
+                
                 endpoint_info = {
                     'endpoint_url': endpoint_url,
                     'http_method': http_method,
@@ -627,7 +707,9 @@ def find_mapping_endpoints(file_path: str, base_url: str, class_name: str, inter
                     'class_name': class_name,
                     'interface_name': interface_name,
                     'mapping_line': i,
-                    'function_line': function_start_line if function_start_line else None
+                    'function_line': function_start_line if function_start_line else None,
+                    'cache_ttl_ms': cache_ttl_ms,  # None = not cacheable, CACHE_UNTIL_INVALIDATED = until invalidated
+                    'no_compression': no_compression  # True = @NoCompression
                 }
                 endpoints.append(endpoint_info)
         
@@ -774,7 +856,9 @@ def format_endpoint_with_advanced_signature(endpoint: Dict[str, Any]) -> Dict[st
             'endpoint_type': str,              # "POST", "PUT", "GET", "DELETE", "PATCH"
             'return_type': str,                # e.g., "Void", "MyReturnDto", "int"
             'function_name': str,              # e.g., "SomeFun", "CreateUser"
-            'parameters': List[Dict]           # List of parameter dictionaries (maintains order)
+            'parameters': List[Dict],          # List of parameter dictionaries (maintains order)
+            'cache_ttl_ms': Optional[int],     # @Cacheable TTL (CACHE_UNTIL_INVALIDATED = until invalidated), None if not cacheable
+            'no_compression': bool             # @NoCompression present
         }
     """
     # Extract or use existing parameters list
@@ -792,7 +876,9 @@ def format_endpoint_with_advanced_signature(endpoint: Dict[str, Any]) -> Dict[st
         'endpoint_type': endpoint.get('http_method', ''),  # Already in uppercase (GET, POST, etc.)
         'return_type': endpoint.get('return_type', ''),
         'function_name': endpoint.get('function_name', ''),
-        'parameters': parameters
+        'parameters': parameters,
+        'cache_ttl_ms': endpoint.get('cache_ttl_ms'),
+        'no_compression': endpoint.get('no_compression', False)
     }
 
 
@@ -839,6 +925,8 @@ def get_endpoint_with_advanced_signature(
 __all__ = [
     'find_class_and_interface',
     'find_class_boundaries',
+    'CACHE_UNTIL_INVALIDATED',
+    'find_cacheable_ttl',
     'parse_function_signature',
     'parse_function_signature_advanced',
     '_parse_single_parameter',
@@ -2,43 +2,109 @@
 """
 Script to generate function pointer code for HTTP mapping endpoints.
 Takes endpoint details as command-line parameters and generates the appropriate
-function pointer template based on the HTTP method (GET, POST, PUT, DELETE, PATCH).
+routing table entry ({ HttpMethod::X, "url", handler },) for HttpRequestDispatcher.
 """
 
 import argparse
 from typing import Dict, Optional, List, Any, Tuple
 
 
-def get_mapping_variable_name(http_method: str) -> str:
+def get_http_method_enum(http_method: str) -> str:
     """
-    Get the mapping variable name based on HTTP method.
+    Get the C++ HttpMethod enumerator for an HTTP method.
     
     Args:
         http_method: HTTP method (GET, POST, PUT, DELETE, PATCH)
         
     Returns:
-        Mapping variable name (e.g., "getMappings", "postMappings", etc.)
+        Enumerator expression (e.g., "HttpMethod::GET", "HttpMethod::POST", etc.)
     """
-    method_lower = http_method.lower()
-    return f"{method_lower}Mappings"
+    return f"HttpMethod::{http_method.upper()}"
+
+
+def is_singleton_scope(scope: Optional[str]) -> bool:
+    """
+    Check whether a controller scope yields one shared instance.
+    
+    Args:
+        scope: Scope from L2_get_file_scope (SINGLETON, PROTOTYPE, SINGLETON_VALIDATOR, PROTOTYPE_VALIDATOR)
+        
+    Returns:
+        True for SINGLETON and SINGLETON_VALIDATOR, False otherwise (including unknown scope)
+    """
+    return scope in ("SINGLETON", "SINGLETON_VALIDATOR")
+
+
+def get_controller_instance_name(interface_name: str) -> str:
+    """
+    Get the name of the variable holding a resolved singleton controller.
+    
+    Args:
+        interface_name: Controller interface name (e.g., "IUserController")
+        
+    Returns:
+        Variable name (e.g., "userControllerInstance")
+    """
+    name = interface_name[1:] if len(interface_name) > 1 and interface_name[0] == 'I' and interface_name[1].isupper() else interface_name
+    return f"{name[0].lower()}{name[1:]}Instance"
+
+
+def generate_controller_instance_declaration(interface_name: str) -> str:
+    """
+    Generate the declaration that resolves a singleton controller once, inside
+    HttpRequestDispatcher::InitializeMappings(). The handlers are capture-less lambdas,
+    which may use this static local without capturing it.
+    
+    Args:
+        interface_name: Controller interface name (e.g., "IUserController")
+        
+    Returns:
+        Declaration line
+    """
+    return (f"static const {interface_name}Ptr {get_controller_instance_name(interface_name)} = "
+            f"Implementation<{interface_name}>::type::GetInstance();")
+
+
+def generate_controller_lookup(interface_name: str, scope: Optional[str]) -> str:
+    """
+    Generate the handler line that obtains the controller.
+    
+    Singletons use the instance resolved in InitializeMappings(); prototypes (and files
+    whose scope is unknown) ask the DI container for an instance on every request.
+    
+    Args:
+        interface_name: Controller interface name (e.g., "IUserController")
+        scope: Controller scope from L2_get_file_scope
+        
+    Returns:
+        Code lines (with trailing newline)
+    """
+    if is_singleton_scope(scope):
+        code = "//                 AUTOWIRED (singleton, resolved once in InitializeMappings)\n"
+        code += f"    const {interface_name}Ptr& controller = {get_controller_instance_name(interface_name)};\n"
+    else:
+        code = "//                 AUTOWIRED (prototype, new instance per request)\n"
+        code += f"    {interface_name}Ptr controller = Implementation<{interface_name}>::type::GetInstance();\n"
+    return code
 
 
 def parse_response_entity_type(return_type: str) -> Tuple[bool, Optional[str]]:
     """
-    Parse return type to check if it's ResponseEntity<T> and extract the entity type.
+    Parse return type to check if it's ResponseEntity<T> (or HttpResult<T>, which is
+    converted by the same ToHttpResponse<T> call) and extract the entity type.
     
     Args:
-        return_type: Return type string (e.g., "ResponseEntity<StdString>", "ResponseEntity<Int>", "int")
+        return_type: Return type string (e.g., "ResponseEntity<StdString>", "HttpResult<Int>", "int")
         
     Returns:
         Tuple of (is_response_entity, entity_type)
-        - is_response_entity: True if return type is ResponseEntity<T>, False otherwise
-        - entity_type: The entity type T if it's ResponseEntity<T>, None otherwise
+        - is_response_entity: True if return type is ResponseEntity<T> or HttpResult<T>, False otherwise
+        - entity_type: The entity type T if it's ResponseEntity<T> or HttpResult<T>, None otherwise
     """
     cleaned = return_type.strip()
     
-    # Check if it starts with "ResponseEntity<" (case-insensitive)
-    if not cleaned.lower().startswith("responseentity<"):
+    # Check if it starts with "ResponseEntity<" or "HttpResult<" (case-insensitive)
+    if not cleaned.lower().startswith(("responseentity<", "httpresult<")):
         return (False, None)
     
     # Find the opening and closing angle brackets
@@ -73,6 +139,85 @@ def parse_response_entity_type(return_type: str) -> Tuple[bool, Optional[str]]:
     return (True, entity_type)
 
 
+def is_body_stream_type(class_name: str) -> bool:
+    """
+    Check whether a @RequestBody parameter type is a body stream (IHttpBodyStream&).
+    
+    Stream parameters are not deserialized: the handler receives an HttpBodyStream over
+    the request body and reads it chunk by chunk.
+    
+    Args:
+        class_name: Parameter type (e.g., "IHttpBodyStream&", "SomeInputDto")
+        
+    Returns:
+        True for IHttpBodyStream / HttpBodyStream parameters (references or not)
+    """
+    cleaned = class_name.strip()
+    if cleaned.startswith('const '):
+        cleaned = cleaned[6:].strip()
+    cleaned = cleaned.rstrip('&').strip()
+    return cleaned in ("IHttpBodyStream", "HttpBodyStream")
+
+
+def get_conversion_type(class_name: str) -> str:
+    """
+    Get the type of the local a PathVariable or RequestParam parameter is converted into.
+    
+    'const' and references are stripped, and the result is wrapped in std::remove_cv_t so
+    the repo's const typedefs (CStdString, CInt, CBool, ...) also give an assignable local.
+    
+    Args:
+        class_name: Parameter type (e.g., "const int", "CStdString", "StdString&")
+        
+    Returns:
+        Type for the local and the TryConvertToType argument (e.g., "std::remove_cv_t<CInt>")
+    """
+    cleaned = class_name.strip()
+    if cleaned.startswith('const '):
+        cleaned = cleaned[6:].strip()
+    cleaned = cleaned.rstrip('&').strip()
+    return f"std::remove_cv_t<{cleaned}>"
+
+
+def generate_request_body_argument(class_name: str, stream_variable: str) -> str:
+    """
+    Generate the call argument of a @RequestBody parameter.
+    
+    Args:
+        class_name: Parameter type
+        stream_variable: Name of the HttpBodyStream local declared for stream parameters
+        
+    Returns:
+        The stream local for body streams, a Deserialize<T>() of the body otherwise
+    """
+    if is_body_stream_type(class_name):
+        return stream_variable
+    return f"nayan::serializer::SerializationUtility::Deserialize<{class_name}>(context.GetBody())"
+
+
+def generate_cache_ttl_field(cache_ttl_ms: Optional[int], no_compression: bool = False) -> str:
+    """
+    Generate the trailing HttpRoute::cacheTtlMs (and HttpRoute::noCompression) initializers
+    of a routing table entry.
+    
+    Args:
+        cache_ttl_ms: @Cacheable TTL in milliseconds (negative = until invalidated, see
+            L3 CACHE_UNTIL_INVALIDATED), None if not cacheable
+        no_compression: True for @NoCompression endpoints
+        
+    Returns:
+        ", <ttl>[, true]" when either is set, empty string otherwise (fields default to
+        HttpRouteNotCached / false)
+    """
+    if cache_ttl_ms is None:
+        ttl_field = ", HttpRouteNotCached" if no_compression else ""
+    elif cache_ttl_ms < 0:
+        ttl_field = ", HttpRouteCacheUntilInvalidated"
+    else:
+        ttl_field = f", {cache_ttl_ms}u"
+    return ttl_field + (", true" if no_compression else "")
+
+
 def generate_function_pointer(
     url: str,
     http_method: str,
@@ -95,8 +240,8 @@ def generate_function_pointer(
     Returns:
         Generated function pointer code as string
     """
-    # Get the mapping variable name based on HTTP method
-    mapping_var = get_mapping_variable_name(http_method)
+    # Get the HttpMethod enumerator for the routing table entry
+    method_enum = get_http_method_enum(http_method)
     
     # Clean return type: remove common C++ keywords (Public, Private, Protected, Virtual, etc.)
     # and extract just the actual type
@@ -116,36 +261,46 @@ def generate_function_pointer(
     
     # Generate the function pointer code
     # Return type is now IHttpResponsePtr instead of StdString
-    code = f"{mapping_var}[\"{url}\"] = [](CStdString arg) -> IHttpResponsePtr {{\n"
+    # Handlers receive a const HttpRequestContext& (body and path variables as views)
+    has_argument = bool(first_arg_type and first_arg_type.lower() not in ["", "none", "(none)"])
+    context_param = "const HttpRequestContext& context" if has_argument else "const HttpRequestContext& /*context*/"
+    code = f"{{ {method_enum}, \"{url}\", []({context_param}) -> IHttpResponsePtr {{\n"
     code += "//                 AUTOWIRED\n"
     code += f"    {interface_name}Ptr controller = Implementation<{interface_name}>::type::GetInstance();\n"
     
+    # A body stream parameter reads the body in place instead of deserializing it
+    argument = ""
+    if has_argument:
+        if is_body_stream_type(first_arg_type):
+            code += "    HttpBodyStream bodyStream(context.GetBodyView());\n"
+        argument = generate_request_body_argument(first_arg_type, "bodyStream")
+    
     if is_void:
         # For void return types, call controller method and return CreateOkResponse() (no body)
         if first_arg_type and first_arg_type.lower() not in ["", "none", "(none)"]:
-            code += f"    controller->{function_name}(nayan::serializer::SerializationUtility::Deserialize<{first_arg_type}>(arg));\n"
+            code += f"    controller->{function_name}({argument});\n"
         else:
             code += f"    controller->{function_name}();\n"
         code += "    return ResponseEntityConverter::CreateOkResponse();\n"
     elif is_response_entity:
-        # For ResponseEntity<T> return types, store return value and use ToHttpResponse<EntityType>(returnValue)
+        # For ResponseEntity<T> return types, store return value and move it into ToHttpResponse<EntityType>(std::move(returnValue))
         # Handle case where there's no argument (first_arg_type is empty or "none")
         if first_arg_type and first_arg_type.lower() not in ["", "none", "(none)"]:
-            code += f"    {cleaned_return_type} returnValue = controller->{function_name}(nayan::serializer::SerializationUtility::Deserialize<{first_arg_type}>(arg));\n"
+            code += f"    {cleaned_return_type} returnValue = controller->{function_name}({argument});\n"
         else:
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}();\n"
-        code += f"    return ResponseEntityConverter::ToHttpResponse<{entity_type}>(returnValue);\n"
+        code += f"    return ResponseEntityConverter::ToHttpResponse<{entity_type}>(std::move(returnValue));\n"
     else:
-        # For non-void, non-ResponseEntity return types, store return value and use CreateOkResponse<T>(returnValue)
+        # For non-void, non-ResponseEntity return types, store return value and move it into CreateOkResponse<T>(std::move(returnValue))
         # Handle case where there's no argument (first_arg_type is empty or "none")
         if first_arg_type and first_arg_type.lower() not in ["", "none", "(none)"]:
-            code += f"    {cleaned_return_type} returnValue = controller->{function_name}(nayan::serializer::SerializationUtility::Deserialize<{first_arg_type}>(arg));\n"
+            code += f"    {cleaned_return_type} returnValue = controller->{function_name}({argument});\n"
         else:
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}();\n"
         
-        code += f"    return ResponseEntityConverter::CreateOkResponse<{cleaned_return_type}>(returnValue);\n"
+        code += f"    return ResponseEntityConverter::CreateOkResponse<{cleaned_return_type}>(std::move(returnValue));\n"
     
-    code += "};"
+    code += "}},"
     
     return code
 
@@ -155,8 +310,13 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
     Generate function pointer code for an HTTP mapping endpoint using advanced parameter parsing.
     
     This function generates code that handles:
-    - RequestBody parameters (deserialized from payload)
-    - PathVariable parameters (extracted from variables map using ConvertToType)
+    - RequestBody parameters (deserialized from payload, or an HttpBodyStream for
+      IHttpBodyStream& parameters)
+    - PathVariable parameters (converted from the context's path variable views with
+      TryConvertToType, decoding into the request arena; an invalid value returns 400
+      Bad Request)
+    - RequestParam parameters (looked up in the query string and converted the same way;
+      a missing or invalid value returns 400 Bad Request)
     - Void and non-void return types
     
     Args:
@@ -167,7 +327,11 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
                 'endpoint_type': str,              # "POST", "PUT", "GET", "DELETE", "PATCH"
                 'return_type': str,                # e.g., "Void", "MyReturnDto", "int"
                 'function_name': str,              # e.g., "SomeFun", "CreateUser"
-                'parameters': List[Dict]           # List of parameter dictionaries
+                'parameters': List[Dict],          # List of parameter dictionaries
+                'controller_scope': str,           # Optional, from L2_get_file_scope (e.g., "SINGLETON")
+                'cache_ttl_ms': int,               # Optional, @Cacheable TTL (negative = until invalidated,
+                                                   # 0 = @Cacheable(0), rejected with an #error)
+                'no_compression': bool             # Optional, @NoCompression present
             }
     
     Returns:
@@ -180,9 +344,12 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
     return_type = formatted_endpoint.get('return_type', '')
     function_name = formatted_endpoint.get('function_name', '')
     parameters = formatted_endpoint.get('parameters', [])
+    controller_scope = formatted_endpoint.get('controller_scope')  # None: resolve per request
+    cache_ttl_ms = formatted_endpoint.get('cache_ttl_ms')  # None: not cacheable
+    no_compression = formatted_endpoint.get('no_compression', False)
     
-    # Get the mapping variable name based on HTTP method
-    mapping_var = get_mapping_variable_name(endpoint_type)
+    # Get the HttpMethod enumerator for the routing table entry
+    method_enum = get_http_method_enum(endpoint_type)
     
     # Clean return type: remove common C++ keywords
     cleaned_return_type = return_type.strip()
@@ -200,6 +367,7 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
     # Check which parameters are used
     has_request_body = False
     has_path_variable = False
+    has_request_param = False
     
     for param in parameters:
         param_type = param.get('type', '')
@@ -207,55 +375,88 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
             has_request_body = True
         elif param_type == 'PathVariable':
             has_path_variable = True
+        elif param_type == 'RequestParam':
+            has_request_param = True
         else:
             # Fallback: treat as RequestBody
             has_request_body = True
     
-    # Generate lambda signature with commented unused parameters
-    # Return type is now IHttpResponsePtr instead of StdString
-    if has_request_body and has_path_variable:
-        # Both are used
-        lambda_signature = "[](CStdString payload, StdMap<StdString, StdString> variables) -> IHttpResponsePtr"
-    elif has_request_body and not has_path_variable:
-        # Only payload is used
-        lambda_signature = "[](CStdString payload, StdMap<StdString, StdString> /*variables*/) -> IHttpResponsePtr"
-    elif not has_request_body and has_path_variable:
-        # Only variables is used
-        lambda_signature = "[](CStdString /*payload*/, StdMap<StdString, StdString> variables) -> IHttpResponsePtr"
+    # Generate lambda signature; the context is commented out when no parameter reads it
+    # Handlers receive a const HttpRequestContext& (body, path variables and query as views)
+    if has_request_body or has_path_variable or has_request_param:
+        lambda_signature = "[](const HttpRequestContext& context) -> IHttpResponsePtr"
     else:
         # Neither is used (no parameters)
-        lambda_signature = "[](CStdString /*payload*/, StdMap<StdString, StdString> /*variables*/) -> IHttpResponsePtr"
-    
-    # Generate the function pointer code
-    code = f"{mapping_var}[\"{complete_url}\"] = {lambda_signature} {{\n"
-    code += "//                 AUTOWIRED\n"
-    code += f"    {controller_interface}Ptr controller = Implementation<{controller_interface}>::type::GetInstance();\n"
+        lambda_signature = "[](const HttpRequestContext& /*context*/) -> IHttpResponsePtr"
+    
+    # Generate the function pointer code. @Cacheable(0) would mean "not cached" to the
+    # dispatcher (HttpRouteNotCached), so the build stops on it instead
+    code = ""
+    if cache_ttl_ms == 0:
+        code += f"#error \"@Cacheable(0) on {endpoint_type} {complete_url}: use @Cacheable to cache until invalidated, or a TTL of at least 1 ms\"\n"
+    code += f"{{ {method_enum}, \"{complete_url}\", {lambda_signature} {{\n"
+    
+    # Convert path variables first: an invalid value is answered with 400 before the
+    # controller is resolved (TryConvertToType neither throws nor allocates for numbers;
+    # URL decoding goes through the request arena, so std::string_view parameters cost no
+    # heap allocation)
+    converted_args = {}
+    for index, param in enumerate(parameters):
+        if param.get('type', '') != 'PathVariable':
+            continue
+        param_sub_type = param.get('subType', '')
+        # Strip const and references: the converted value is a local the call reads from
+        type_for_conversion = get_conversion_type(param.get('class_name', ''))
+        variable_name = f"pathVariable{index}"
+        code += f"    {type_for_conversion} {variable_name}{{}};\n"
+        code += f"    if (!HttpRequestDispatcher::TryConvertToType<{type_for_conversion}>(context.GetPathVariable(\"{param_sub_type}\"), {variable_name}, context.GetArena())) {{\n"
+        code += f"        return HttpRequestDispatcher::InvalidPathVariableResponse(\"{param_sub_type}\", context.GetPathVariable(\"{param_sub_type}\"));\n"
+        code += "    }\n"
+        converted_args[index] = variable_name
+    
+    # Query parameters: only the declared ones are looked up (no parsing of the whole
+    # query string) and decoded; a missing one is a 400 like an invalid one
+    for index, param in enumerate(parameters):
+        if param.get('type', '') != 'RequestParam':
+            continue
+        param_sub_type = param.get('subType', '') or param.get('param_name', '')
+        type_for_conversion = get_conversion_type(param.get('class_name', ''))
+        raw_name = f"rawRequestParam{index}"
+        variable_name = f"requestParam{index}"
+        code += f"    std::string_view {raw_name};\n"
+        code += f"    if (!context.TryGetQueryParameter(\"{param_sub_type}\", {raw_name})) {{\n"
+        code += f"        return HttpRequestDispatcher::MissingRequestParamResponse(\"{param_sub_type}\");\n"
+        code += "    }\n"
+        code += f"    {type_for_conversion} {variable_name}{{}};\n"
+        code += f"    if (!HttpRequestDispatcher::TryConvertToType<{type_for_conversion}>({raw_name}, {variable_name}, context.GetArena())) {{\n"
+        code += f"        return HttpRequestDispatcher::InvalidRequestParamResponse(\"{param_sub_type}\", {raw_name});\n"
+        code += "    }\n"
+        converted_args[index] = variable_name
+    
+    code += generate_controller_lookup(controller_interface, controller_scope)
+    
+    # Body stream parameters read the body in place (no Deserialize, no copy)
+    for index, param in enumerate(parameters):
+        if param.get('type', '') not in ('PathVariable', 'RequestParam') and is_body_stream_type(param.get('class_name', '')):
+            code += f"    HttpBodyStream bodyStream{index}(context.GetBodyView());\n"
     
     # Build function call arguments
     function_args = []
     
-    for param in parameters:
+    for index, param in enumerate(parameters):
         param_type = param.get('type', '')
         param_class_name = param.get('class_name', '')
         param_sub_type = param.get('subType', '')  # Path variable name for PathVariable
         
         if param_type == 'RequestBody':
-            # Deserialize from payload
-            function_args.append(f"nayan::serializer::SerializationUtility::Deserialize<{param_class_name}>(payload)")
-        elif param_type == 'PathVariable':
-            # Extract from variables map and convert to type
-            # Strip 'const' and other qualifiers for ConvertToType template parameter
-            # ConvertToType needs the base type, not const-qualified
-            type_for_conversion = param_class_name.strip()
-            # Remove 'const' keyword if present
-            if type_for_conversion.startswith('const '):
-                type_for_conversion = type_for_conversion[6:].strip()
-            # Use ConvertToType to convert the string value to the appropriate type
-            # Qualify with class name since it's a member function template
-            function_args.append(f"HttpRequestDispatcher::ConvertToType<{type_for_conversion}>(variables[\"{param_sub_type}\"])")
+            # Deserialize from the request body (referenced, not copied), or hand out the stream
+            function_args.append(generate_request_body_argument(param_class_name, f"bodyStream{index}"))
+        elif param_type in ('PathVariable', 'RequestParam'):
+            # Converted (and validated) above; strings are moved into the call
+            function_args.append(f"std::move({converted_args[index]})")
         else:
             # Fallback: treat as RequestBody
-            function_args.append(f"nayan::serializer::SerializationUtility::Deserialize<{param_class_name}>(payload)")
+            function_args.append(generate_request_body_argument(param_class_name, f"bodyStream{index}"))
     
     # Generate function call
     if is_void:
@@ -267,23 +468,23 @@ def generate_function_pointer_advanced(formatted_endpoint: Dict[str, Any]) -> st
             code += f"    controller->{function_name}();\n"
         code += "    return ResponseEntityConverter::CreateOkResponse();\n"
     elif is_response_entity:
-        # For ResponseEntity<T> return types, store return value and use ToHttpResponse<EntityType>(returnValue)
+        # For ResponseEntity<T> return types, store return value and move it into ToHttpResponse<EntityType>(std::move(returnValue))
         if function_args:
             args_str = ", ".join(function_args)
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}({args_str});\n"
         else:
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}();\n"
-        code += f"    return ResponseEntityConverter::ToHttpResponse<{entity_type}>(returnValue);\n"
+        code += f"    return ResponseEntityConverter::ToHttpResponse<{entity_type}>(std::move(returnValue));\n"
     else:
-        # For non-void, non-ResponseEntity return types, store return value and use CreateOkResponse<T>(returnValue)
+        # For non-void, non-ResponseEntity return types, store return value and move it into CreateOkResponse<T>(std::move(returnValue))
         if function_args:
             args_str = ", ".join(function_args)
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}({args_str});\n"
         else:
             code += f"    {cleaned_return_type} returnValue = controller->{function_name}();\n"
-        code += f"    return ResponseEntityConverter::CreateOkResponse<{cleaned_return_type}>(returnValue);\n"
+        code += f"    return ResponseEntityConverter::CreateOkResponse<{cleaned_return_type}>(std::move(returnValue));\n"
     
-    code += "};"
+    code += "}" + generate_cache_ttl_field(cache_ttl_ms, no_compression) + "},"
     
     return code
 
@@ -362,7 +563,13 @@ def main():
 
 # Export functions for other scripts to import
 __all__ = [
-    'get_mapping_variable_name',
+    'get_http_method_enum',
+    'is_singleton_scope',
+    'get_controller_instance_name',
+    'generate_controller_instance_declaration',
+    'generate_controller_lookup',
+    'generate_cache_ttl_field',
+    'get_conversion_type',
     'generate_function_pointer',
     'generate_function_pointer_advanced',
     'main'
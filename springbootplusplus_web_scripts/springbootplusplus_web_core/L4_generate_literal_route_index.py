@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+"""
+Script to generate the perfect hash of the literal routes of the routing table.
+Takes the routing table entries ({ HttpMethod::X, "url", handler },) and generates the
+constant arrays of a LiteralRouteIndex (src/LiteralRouteTable.h), so that
+HttpRequestDispatcher finds a route without a {variable} with one hash and one compare.
+
+hash_key() and slot_hash() must stay identical to LiteralRouteTable::Hash() and
+LiteralRouteTable::Slot().
+"""
+
+import argparse
+import re
+import sys
+from typing import Dict, List, Optional, Tuple
+
+MASK32 = 0xFFFFFFFF
+MAX_DISPLACEMENT = 0xFFFF
+MAX_SEEDS = 32
+
+# Same order as HttpMethodIndex() in HttpRoute.h
+HTTP_METHOD_INDEX = {
+    'GET': 0, 'POST': 1, 'PUT': 2, 'PATCH': 3, 'DELETE': 4,
+    'OPTIONS': 5, 'HEAD': 6, 'TRACE': 7, 'CONNECT': 8
+}
+
+# Start of a routing table entry: { HttpMethod::GET, "/api/user",
+ROUTE_ENTRY_PATTERN = re.compile(r'^\s*\{\s*HttpMethod::([A-Z]+)\s*,\s*"((?:[^"\\]|\\.)*)"', re.MULTILINE)
+
+
+def hash_key(seed: int, method_index: int, path: bytes) -> int:
+    """
+    FNV-1a over the method index byte and the path bytes (LiteralRouteTable::Hash).
+    """
+    value = (2166136261 ^ seed) & MASK32
+    value = ((value ^ method_index) * 16777619) & MASK32
+    for byte in path:
+        value = ((value ^ byte) * 16777619) & MASK32
+    return value
+
+
+def slot_hash(value: int, displacement: int) -> int:
+    """
+    Slot hash of a key in a bucket with the given displacement (LiteralRouteTable::Slot).
+    """
+    value ^= (displacement * 0x9E3779B9) & MASK32
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & MASK32
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & MASK32
+    value ^= value >> 16
+    return value
+
+
+def next_power_of_two(value: int) -> int:
+    result = 1
+    while result < value:
+        result <<= 1
+    return result
+
+
+def canonical_path(pattern: str) -> Optional[str]:
+    """
+    Get the path a literal pattern is indexed under (LiteralRouteTable::CanonicalPath).
+
+    Args:
+        pattern: Route pattern
+
+    Returns:
+        Pattern with empty segments removed, or None for variable and trailing-slash patterns
+    """
+    if '{' in pattern or '\\' in pattern:
+        return None
+    if len(pattern) > 1 and pattern.endswith('/'):
+        return None
+    segments = [segment for segment in pattern.split('/') if segment]
+    return '/' + '/'.join(segments)
+
+
+def find_routes(entries_code: str) -> List[Tuple[str, str]]:
+    """
+    Find the method and pattern of every routing table entry, in table order.
+
+    Args:
+        entries_code: Concatenated routing table entries
+
+    Returns:
+        List of (method, pattern) tuples
+    """
+    return [(match.group(1), match.group(2)) for match in ROUTE_ENTRY_PATTERN.finditer(entries_code)]
+
+
+def select_literal_routes(routes: List[Tuple[str, str]]) -> Dict[Tuple[int, str], int]:
+    """
+    Pick the routes to index. As in the trie, a later route for the same method and path
+    replaces an earlier one, and a non-canonical spelling ("/a//b") leaves the path to the trie.
+
+    Args:
+        routes: (method, pattern) tuples in table order
+
+    Returns:
+        Dictionary mapping (method index, path) to the route's table index
+    """
+    selected = {}
+    for table_index, (method, pattern) in enumerate(routes):
+        if method not in HTTP_METHOD_INDEX:
+            continue
+        canonical = canonical_path(pattern)
+        if canonical is None:
+            continue
+        key = (HTTP_METHOD_INDEX[method], canonical)
+        if canonical == pattern:
+            selected[key] = table_index
+        else:
+            selected.pop(key, None)
+    return selected
+
+
+def try_build(keys: List[Tuple[int, bytes, int]], seed: int, bucket_count: int, slot_count: int) -> Optional[Tuple[List[int], List[Optional[int]]]]:
+    """
+    Place the keys with one seed and table size.
+
+    Args:
+        keys: (method index, path bytes, table index) tuples
+        seed: Key hash seed
+        bucket_count: Number of buckets (power of two)
+        slot_count: Number of slots (power of two)
+
+    Returns:
+        (displacements, slots) or None if some bucket found no free displacement
+    """
+    buckets: List[List[Tuple[int, int]]] = [[] for _ in range(bucket_count)]
+    for method_index, path, table_index in keys:
+        value = hash_key(seed, method_index, path)
+        buckets[value & (bucket_count - 1)].append((value, table_index))
+
+    displacements = [0] * bucket_count
+    slots: List[Optional[int]] = [None] * slot_count
+    # Largest buckets first, while most slots are still free
+    for bucket in sorted(range(bucket_count), key=lambda index: -len(buckets[index])):
+        entries = buckets[bucket]
+        if not entries:
+            break
+        for displacement in range(MAX_DISPLACEMENT + 1):
+            placed = [slot_hash(value, displacement) & (slot_count - 1) for value, _ in entries]
+            if len(set(placed)) == len(placed) and all(slots[slot] is None for slot in placed):
+                for slot, (_, table_index) in zip(placed, entries):
+                    slots[slot] = table_index
+                displacements[bucket] = displacement
+                break
+        else:
+            return None
+    return displacements, slots
+
+
+def build_literal_route_index(routes: List[Tuple[str, str]]) -> Optional[Dict[str, object]]:
+    """
+    Compute the perfect hash of the literal routes.
+
+    Args:
+        routes: (method, pattern) tuples in table order
+
+    Returns:
+        Dictionary with 'seed', 'displacements' and 'slots' (table index or None per slot),
+        or None if there is no literal route (or no perfect hash was found)
+    """
+    selected = select_literal_routes(routes)
+    if not selected:
+        return None
+
+    keys = [(method_index, path.encode('utf-8'), table_index) for (method_index, path), table_index in selected.items()]
+    count = len(keys)
+    bucket_count = next_power_of_two((count + 1) // 2)
+    slot_count = next_power_of_two(count + count // 4)
+    for _ in range(4):
+        for seed in range(MAX_SEEDS):
+            result = try_build(keys, seed, bucket_count, slot_count)
+            if result:
+                displacements, slots = result
+                return {'seed': seed, 'displacements': displacements, 'slots': slots}
+        slot_count <<= 1
+    return None
+
+
+def format_array(values: List[str], indent: str = "    ", per_line: int = 8) -> str:
+    """
+    Format array initializer values, per_line values per line.
+    """
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(values[start:start + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def generate_literal_route_index(entries_code: str, table_name: str = "routes") -> List[str]:
+    """
+    Generate the LiteralRouteIndex declarations for a routing table.
+
+    Args:
+        entries_code: Concatenated routing table entries of table_name
+        table_name: Name of the static HttpRoute array the slots point into
+
+    Returns:
+        Code lines declaring literalRouteDisplacements, literalRouteSlots and
+        literalRouteIndex, or an empty list if the table has no literal route
+    """
+    index = build_literal_route_index(find_routes(entries_code))
+    if index is None:
+        return []
+
+    displacements = [f"{value}" for value in index['displacements']]
+    slots = ["nullptr" if value is None else f"&{table_name}[{value}]" for value in index['slots']]
+    return [
+        "// Perfect hash of the literal routes (L4_generate_literal_route_index.py)",
+        "static const UInt16 literalRouteDisplacements[] = {",
+        format_array(displacements, per_line=16),
+        "};",
+        "static const HttpRoute* const literalRouteSlots[] = {",
+        format_array(slots),
+        "};",
+        f"static const LiteralRouteIndex literalRouteIndex{{{index['seed']}u, literalRouteDisplacements, "
+        f"{len(index['displacements']) - 1}u, literalRouteSlots, {len(index['slots']) - 1}u}};"
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the perfect hash of the literal routes of a routing table",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  python L4_generate_literal_route_index.py routes.txt     # Entries generated by L5_generate_all_endpoints.py
+        """
+    )
+
+    parser.add_argument(
+        "file",
+        help="File containing routing table entries"
+    )
+
+    args = parser.parse_args()
+
+    try:
+        with open(args.file, 'r', encoding='utf-8') as file:
+            entries_code = file.read()
+    except Exception as e:
+        # print(f"Error reading file '{args.file}': {e}")
+        sys.exit(1)
+
+    generated_code = '\n'.join(generate_literal_route_index(entries_code))
+    # print(generated_code)
+    return generated_code
+
+
+# Export functions for other scripts to import
+__all__ = [
+    'hash_key',
+    'slot_hash',
+    'canonical_path',
+    'find_routes',
+    'select_literal_routes',
+    'build_literal_route_index',
+    'generate_literal_route_index',
+    'main'
+]
+
+
+if __name__ == "__main__":
+    # When run as script, execute main and store result
+    result = main()
@@ -5,15 +5,16 @@ For each file with RestController macro:
 1. Gets base URL
 2. Gets endpoint details
 3. Organizes endpoints by HTTP method
-4. Generates function pointer code for each endpoint
-5. Wraps everything in GenerateMappings() function
+4. Generates a routing table entry for each endpoint
+5. Wraps the entries in a static HttpRoute table registered with the dispatcher, together
+   with the perfect hash of its literal routes
 """
 
 import argparse
 import sys
 import os
 from pathlib import Path
-from typing import List, Dict, Any, Optional
+from typing import List, Dict, Any, Optional, Tuple
 
 # Add springbootplusplus_web_core directory to path for imports (current directory)
 script_dir = os.path.dirname(os.path.abspath(__file__))
@@ -24,6 +25,8 @@ try:
     import L2_get_base_url
     import L3_get_endpoint_details
     import L4_generate_function_pointer
+    import L4_generate_literal_route_index
+    import L2_get_file_scope
 except ImportError as e:
     # print(f"Error: Could not import required modules: {e}")
     # print("Make sure L1_check_rest_controller.py, L2_get_base_url.py, L3_get_endpoint_details.py, and L4_generate_function_pointer.py are in the springbootplusplus_web_core directory.")
@@ -67,11 +70,15 @@ def process_file(file_path: str) -> Optional[List[Dict[str, Any]]]:
     if not endpoint_details['success'] or not endpoint_details['endpoints']:
         return []
     
+    # Controller scope decides whether handlers reuse one instance or resolve per request
+    controller_scope = L2_get_file_scope.get_file_scope(file_path)
+    
     # Return the endpoints with file path for reference
     endpoints = endpoint_details['endpoints']
     for endpoint in endpoints:
         endpoint['file_path'] = file_path
         endpoint['base_url'] = base_url
+        endpoint['controller_scope'] = controller_scope
     
     return endpoints
 
@@ -139,6 +146,7 @@ def generate_code_for_endpoint(endpoint: Dict[str, Any]) -> str:
     """
     # Format the endpoint to the advanced structure
     formatted_endpoint = L3_get_endpoint_details.format_endpoint_with_advanced_signature(endpoint)
+    formatted_endpoint['controller_scope'] = endpoint.get('controller_scope')
     
     # Generate code using the advanced function
     return L4_generate_function_pointer.generate_function_pointer_advanced(formatted_endpoint)
@@ -204,6 +212,100 @@ def generate_code_for_file(file_path: str) -> Optional[str]:
     return '\n'.join(code_lines)
 
 
+def get_singleton_controllers(file_path: str) -> List[str]:
+    """
+    Get the controller interfaces of a file whose handlers use a shared instance.
+    
+    Args:
+        file_path: Path to the C++ file
+        
+    Returns:
+        Interface names (empty if the file is prototype-scoped or has no endpoints)
+    """
+    endpoints = process_file(file_path)
+    if not endpoints:
+        return []
+    
+    interfaces = []
+    for endpoint in endpoints:
+        interface_name = endpoint.get('interface_name', '')
+        if (interface_name and interface_name not in interfaces and
+                L4_generate_function_pointer.is_singleton_scope(endpoint.get('controller_scope'))):
+            interfaces.append(interface_name)
+    return interfaces
+
+
+def route_shape(pattern: str) -> Tuple[str, ...]:
+    """
+    Get the segments of a pattern as EndpointTrie stores them, with variables blanked.
+    "/api//{id}/" -> ("api", "{}", "")
+    """
+    segments = [segment for segment in pattern.strip('/').split('/') if segment]
+    shape = tuple("{}" if segment.startswith('{') and segment.endswith('}') and len(segment) >= 2 else segment
+                  for segment in segments)
+    if len(pattern) > 1 and pattern.endswith('/'):
+        shape += ("",)
+    return shape
+
+
+def find_route_conflicts(entries_code: str) -> List[Tuple[str, str, str]]:
+    """
+    Find routes of the same method whose patterns only differ by variable names
+    ("/api/{id}" and "/api/{name}"): they match exactly the same paths, so one of them
+    could never be reached. A repeated pattern is not a conflict; the later route wins.
+
+    Args:
+        entries_code: Concatenated routing table entries
+
+    Returns:
+        List of (method, first pattern, conflicting pattern) tuples
+    """
+    conflicts = []
+    seen = {}
+    for method, pattern in L4_generate_literal_route_index.find_routes(entries_code):
+        shape = route_shape(pattern)
+        normalized = tuple(segment for segment in pattern.strip('/').split('/') if segment)
+        key = (method, shape)
+        if key not in seen:
+            seen[key] = (pattern, normalized)
+        elif seen[key][1] != normalized:
+            conflicts.append((method, seen[key][0], pattern))
+    return conflicts
+
+
+def wrap_route_table(entries_code: str, singleton_controllers: Optional[List[str]] = None) -> str:
+    """
+    Wrap routing table entries in the static HttpRoute array that
+    HttpRequestDispatcher::InitializeMappings() registers with its trie.
+    Singleton controllers are resolved once, ahead of the table; the perfect hash of
+    the literal routes follows it. Conflicting routes (see find_route_conflicts) turn
+    into #error lines so the build stops on them.
+    
+    Args:
+        entries_code: Concatenated entries ({ HttpMethod::X, "url", handler },)
+        singleton_controllers: Interfaces referenced by singleton handlers
+        
+    Returns:
+        Code for the InitializeMappings() body
+    """
+    code_lines = []
+    for method, first, second in find_route_conflicts(entries_code):
+        # print(f"Error: conflicting routes {method} {first} and {method} {second}", file=sys.stderr)
+        code_lines.append(f'#error "Conflicting routes: {method} {first} and {method} {second}"')
+    for interface_name in singleton_controllers or []:
+        code_lines.append(L4_generate_function_pointer.generate_controller_instance_declaration(interface_name))
+    code_lines.append("static const HttpRoute routes[] = {")
+    code_lines.append(entries_code.rstrip())
+    code_lines.append("};")
+    literal_index_lines = L4_generate_literal_route_index.generate_literal_route_index(entries_code)
+    if literal_index_lines:
+        code_lines.extend(literal_index_lines)
+        code_lines.append("RegisterRoutes(routes, sizeof(routes) / sizeof(routes[0]), literalRouteIndex);")
+    else:
+        code_lines.append("RegisterRoutes(routes, sizeof(routes) / sizeof(routes[0]));")
+    return '\n'.join(code_lines)
+
+
 def generate_all_mappings_code(endpoint_maps: Dict[str, List[Dict[str, Any]]]) -> str:
     """
     Generate the complete GenerateMappings() function with all endpoint code.
@@ -215,8 +317,7 @@ def generate_all_mappings_code(endpoint_maps: Dict[str, List[Dict[str, Any]]]) -
         Complete GenerateMappings() function code as string
     """
     code_lines = []
-    code_lines.append("void GenerateMappings() {")
-    code_lines.append("")
+    singleton_controllers = []
     
     # Generate code for each HTTP method
     for http_method in ['GET', 'POST', 'PUT', 'DELETE', 'PATCH']:
@@ -230,6 +331,10 @@ def generate_all_mappings_code(endpoint_maps: Dict[str, List[Dict[str, Any]]]) -
         
         # Generate code for each endpoint
         for endpoint in endpoints:
+            interface_name = endpoint.get('interface_name', '')
+            if (interface_name and interface_name not in singleton_controllers and
+                    L4_generate_function_pointer.is_singleton_scope(endpoint.get('controller_scope'))):
+                singleton_controllers.append(interface_name)
             endpoint_code = generate_code_for_endpoint(endpoint)
             # Indent each line of the endpoint code
             indented_lines = ['    ' + line for line in endpoint_code.split('\n')]
@@ -238,9 +343,8 @@ def generate_all_mappings_code(endpoint_maps: Dict[str, List[Dict[str, Any]]]) -
         
         code_lines.append("")  # Add blank line between HTTP method sections
     
-    code_lines.append("}")
-    
-    return '\n'.join(code_lines)
+    table_lines = ['    ' + line if line.strip() else '' for line in wrap_route_table('\n'.join(code_lines), singleton_controllers).split('\n')]
+    return "void GenerateMappings() {\n" + '\n'.join(table_lines) + "\n}"
 
 
 def main():
@@ -324,6 +428,10 @@ __all__ = [
     'process_all_files',
     'generate_code_for_endpoint',
     'generate_code_for_file',
+    'get_singleton_controllers',
+    'route_shape',
+    'find_route_conflicts',
+    'wrap_route_table',
     'generate_all_mappings_code',
     'main'
 ]
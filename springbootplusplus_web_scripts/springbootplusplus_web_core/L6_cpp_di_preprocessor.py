@@ -6,10 +6,16 @@ This script orchestrates the complete dependency injection preprocessing workflo
 1. Finding all C++ source files in the specified include/exclude paths
 2. Running L5_process_di.py on each source file to process COMPONENT and AUTOWIRED macros
 
+Processed annotations are rewritten to /*--@Component--*/ etc., so only files that still
+contain an unprocessed /* @Component */, /* @Service */ or /* @Autowired */ are handed to
+L5_process_di.py; an unchanged project costs one read per file instead of a chain of
+subprocesses per file.
+
 This is the highest-level script that automates the entire DI preprocessing pipeline.
 """
 
 import argparse
+import re
 import subprocess
 import sys
 import os
@@ -19,6 +25,27 @@ from typing import List, Dict, Optional
 # Get the directory where this script is located
 SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 
+# DI annotation that L5_process_di.py has not processed yet (or the legacy COMPONENT macro line)
+DI_ANNOTATION_PATTERN = re.compile(r'/\*\s*@(?:Component|Service|Autowired)\s*\*/|^\s*COMPONENT\s*$', re.MULTILINE)
+
+
+def needs_di_processing(file_path: str) -> bool:
+    """
+    Check whether a file still contains unprocessed DI annotations.
+    
+    Args:
+        file_path: Path to the C++ file
+        
+    Returns:
+        True if L5_process_di.py has work to do on the file (or it cannot be read)
+    """
+    try:
+        with open(file_path, 'r', encoding='utf-8') as file:
+            return DI_ANNOTATION_PATTERN.search(file.read()) is not None
+    except Exception:
+        # Let L5_process_di.py report the problem
+        return True
+
 
 def find_cpp_files(include_paths: List[str], exclude_paths: List[str]) -> List[str]:
     """
@@ -169,6 +196,19 @@ def process_all_files(cpp_files: List[str], include_paths: List[str], exclude_pa
     }
     
     for i, file_path in enumerate(cpp_files, 1):
+        if not needs_di_processing(file_path):
+            # Nothing to inject (or already processed by a previous build)
+            results['successful_files'] += 1
+            results['file_results'][file_path] = {
+                'success': True,
+                'return_code': 0,
+                'stdout': '',
+                'stderr': '',
+                'errors': [],
+                'skipped': True
+            }
+            continue
+        
         # Process the file
         file_result = run_l5_process_di(file_path, include_paths, exclude_paths, dry_run)
         results['file_results'][file_path] = file_result
@@ -4,7 +4,8 @@ L6 Generate Code for All Sources Script
 
 This script:
 1. Finds all C++ source files (using logic from L6_cpp_di_preprocessor.py)
-2. Generates endpoint code for each file using L5_generate_code_for_file.py
+2. Generates endpoint code for each file using L5_generate_code_for_file.py, in parallel,
+   reusing the cached result of files that did not change since the previous run
 3. Marks REST-related annotations as processed (/* @RestController */, /* @RequestMapping("...") */, etc.) in processed files
 4. Stores valid results in a map
 5. Adds #include statements to EventDispatcher.h
@@ -15,8 +16,9 @@ import argparse
 import sys
 import os
 import re
+import tempfile
 from pathlib import Path
-from typing import Dict, List, Optional
+from typing import Any, Dict, List, Optional
 
 # Add springbootplusplus_web_core directory to path for imports (current directory)
 script_dir = os.path.dirname(os.path.abspath(__file__))
@@ -26,6 +28,7 @@ try:
     import L5_generate_all_endpoints as L5_generate_code_for_file
     import L3_get_endpoint_details
     import L1_find_class_header
+    import incremental_build
 except ImportError as e:
     # print(f"Error: Could not import required modules: {e}")
     # print("Make sure L5_generate_all_endpoints.py, L3_get_endpoint_details.py, and L1_find_class_header.py are in the springbootplusplus_web_core directory.")
@@ -216,53 +219,143 @@ def comment_rest_macros(file_path: str, dry_run: bool = False) -> bool:
         return False
 
 
-def generate_code_map(cpp_files: List[str], dry_run: bool = False) -> Dict[str, Dict[str, str]]:
+# Mapping annotation already rewritten by comment_rest_macros (/*--@GetMapping("...")--*/)
+PROCESSED_MAPPING_PATTERN = re.compile(r'/\*--\s*@(GetMapping|PostMapping|PutMapping|DeleteMapping|PatchMapping)\s*\(')
+
+# Any processed REST annotation, with its argument, to restore it for a re-parse
+PROCESSED_REST_ANNOTATION_PATTERN = re.compile(
+    r'/\*--\s*@(RequestMapping|GetMapping|PostMapping|PutMapping|DeleteMapping|PatchMapping)\s*\(\s*(["\'][^"\']*["\'])\s*\)\s*--\*/')
+
+# comment_rest_macros turns /* @RestController */ into /* @Component */
+COMPONENT_ANNOTATION_PATTERN = re.compile(r'/\*\s*@Component\s*\*/')
+
+
+def read_file(file_path: str) -> str:
+    """
+    Read a source file, returning an empty string if it cannot be read.
+    """
+    try:
+        with open(file_path, 'r', encoding='utf-8') as f:
+            return f.read()
+    except Exception:
+        return ""
+
+
+def parse_source_file(file_path: str) -> Optional[Dict[str, Any]]:
+    """
+    Generate the routing table entries of one source file (read-only, safe to run in a
+    worker process).
+    
+    Args:
+        file_path: Path to the C++ file
+        
+    Returns:
+        Dictionary with 'code', 'interface_name' and 'singleton_controllers' keys, or None
+        if the file has no REST endpoints
+    """
+    generated_code = L5_generate_code_for_file.generate_code_for_file(file_path)
+    if not generated_code or not generated_code.strip():
+        return None
+    
+    # Get interface name from the file
+    class_info = L3_get_endpoint_details.find_class_and_interface(file_path)
+    interface_name = class_info['interface_name'] if class_info else None
+    
+    return {
+        'code': generated_code,
+        'interface_name': interface_name,
+        'singleton_controllers': L5_generate_code_for_file.get_singleton_controllers(file_path)
+    }
+
+
+def parse_processed_source_file(file_path: str) -> Optional[Dict[str, Any]]:
+    """
+    Generate the routing table entries of a controller whose annotations were already
+    marked processed by an earlier build (e.g. edited since).
+    
+    The annotations are restored in a temporary copy next to the file (so relative
+    includes still resolve) and the copy is parsed like a new controller. The result
+    reflects the file as it is now: routes removed from it are gone, routes added to it
+    (still unprocessed) are included.
+    
+    Args:
+        file_path: Path to the C++ file
+        
+    Returns:
+        Same as parse_source_file
+    """
+    contents = read_file(file_path)
+    restored = PROCESSED_REST_ANNOTATION_PATTERN.sub(lambda match: f"/* @{match.group(1)}({match.group(2)}) */", contents)
+    restored = COMPONENT_ANNOTATION_PATTERN.sub("/* @RestController */", restored)
+    
+    directory, file_name = os.path.split(os.path.abspath(file_path))
+    stem, extension = os.path.splitext(file_name)
+    try:
+        fd, temp_path = tempfile.mkstemp(dir=directory, prefix=f".{stem}.", suffix=extension)
+    except OSError:
+        return None
+    try:
+        with os.fdopen(fd, 'w', encoding='utf-8') as file:
+            file.write(restored)
+        return parse_source_file(temp_path)
+    finally:
+        try:
+            os.remove(temp_path)
+        except OSError:
+            pass
+
+
+def generate_code_map(cpp_files: List[str], dry_run: bool = False, cache: Optional["incremental_build.GenerationCache"] = None,
+                      jobs: int = 1) -> Dict[str, Dict[str, str]]:
     """
     Generate code for all source files and store valid results in a map.
     Also comments out REST-related macros in processed files.
     
+    Files whose contents match the cache are not parsed again; the others are parsed with
+    up to `jobs` worker processes. Controller files are rewritten (annotations marked as
+    processed) after parsing, so their cache entry is keyed on the rewritten contents.
+    
     Args:
         cpp_files: List of C++ file paths to process
         dry_run: If True, don't actually comment macros, just show what would be done
+        cache: Per-file result cache (None = parse every file)
+        jobs: Number of parallel parser processes
         
     Returns:
-        Dictionary mapping file paths (absolute) to dictionaries with 'code' and 'interface_name' keys
+        Dictionary mapping file paths (absolute) to dictionaries with 'code', 'interface_name'
+        and 'singleton_controllers' keys, in the order of cpp_files
     """
     # print("🔄 Generating code for files with RestController...")
     
-    code_map = {}
-    processed_count = 0
-    skipped_count = 0
-    
+    results = {}
+    pending_files = []
     for file_path in cpp_files:
-        # Generate code for this file
-        generated_code = L5_generate_code_for_file.generate_code_for_file(file_path)
-        
-        # Only add to map if code is valid (not empty, not None)
-        if generated_code and generated_code.strip():
-            # Get interface name from the file
-            class_info = L3_get_endpoint_details.find_class_and_interface(file_path)
-            interface_name = class_info['interface_name'] if class_info else None
-            
-            code_map[file_path] = {
-                'code': generated_code,
-                'interface_name': interface_name
-            }
-            processed_count += 1
-            
-            # Mark REST-related annotations as processed in this file
-            if not dry_run:
-                # print(f"  Processing REST annotations in: {file_path}")
-                pass
-            else:
-                # print(f"  Would process REST annotations in: {file_path}")
-                pass
-            comment_rest_macros(file_path, dry_run=dry_run)
+        hit, cached_result = cache.get(file_path, incremental_build.file_digest(file_path)) if cache else (False, None)
+        if hit:
+            results[file_path] = cached_result
         else:
-            skipped_count += 1
+            pending_files.append(file_path)
+    
+    for file_path, result in zip(pending_files, incremental_build.run_in_parallel(parse_source_file, pending_files, jobs)):
+        if result is None and PROCESSED_MAPPING_PATTERN.search(read_file(file_path)):
+            # Changed after its annotations were marked processed: parse it again with the
+            # annotations restored, so its routes follow the file (no stale or lost routes)
+            result = parse_processed_source_file(file_path)
+        results[file_path] = result
     
-    # print(f"✅ Processed {processed_count} file(s) with RestController")
-    # print(f"⏭️  Skipped {skipped_count} file(s) without RestController")
+    code_map = {}
+    pending_set = set(pending_files)
+    for file_path in cpp_files:
+        result = results.get(file_path)
+        if result:
+            code_map[file_path] = result
+            if file_path in pending_set:
+                # Mark REST-related annotations as processed in this file
+                comment_rest_macros(file_path, dry_run=dry_run)
+        if cache and not dry_run and file_path in pending_set:
+            cache.put(file_path, incremental_build.file_digest(file_path), result)
+    
+    # print(f"✅ Processed {len(code_map)} file(s) with RestController ({len(pending_files)} parsed, {len(cpp_files) - len(pending_files)} cached)")
     
     return code_map
 
@@ -343,6 +436,7 @@ def add_includes_to_event_dispatcher(file_path: str, includes: List[str]) -> boo
     try:
         with open(file_path, 'r', encoding='utf-8') as f:
             lines = f.readlines()
+        original_lines = list(lines)
         
         # Find line 6 (index 5) which has #include "01-IEventDispatcher.h"
         # We want to add includes after this line
@@ -355,11 +449,14 @@ def add_includes_to_event_dispatcher(file_path: str, includes: List[str]) -> boo
         # Remove all existing controller includes (they will be replaced with correct ones)
         # Look for includes that point to controller files
         import re
+        generated_includes = set(includes)
         lines_to_remove = []
         for i, line in enumerate(lines):
             if line.strip().startswith('#include'):
-                # Check if this is a controller include (contains "controller" in path or matches pattern)
-                if 'controller' in line.lower() or re.search(r'/\d+-[A-Za-z0-9_]*Controller\.h', line):
+                # Check if this is a controller include (contains "controller" in path or matches pattern),
+                # or one this function added last time (re-inserted below, in order)
+                if 'controller' in line.lower() or re.search(r'/\d+-[A-Za-z0-9_]*Controller\.h', line) or \
+                        (i >= 6 and line.strip() in generated_includes):
                     lines_to_remove.append(i)
         
         # Remove lines in reverse order to maintain indices
@@ -391,7 +488,13 @@ def add_includes_to_event_dispatcher(file_path: str, includes: List[str]) -> boo
         
         # Insert new includes after line 6
         if new_includes:
-            lines[insert_index:insert_index] = new_includes + ['\n']  # Add blank line after includes
+            # Add blank line after includes (kept from the previous run when re-adding them)
+            separator = [] if insert_index < len(lines) and not lines[insert_index].strip() else ['\n']
+            lines[insert_index:insert_index] = new_includes + separator
+        
+        if lines == original_lines:
+            # Same controllers as last time: don't touch the file so it is not recompiled
+            return True
         
         # Write back to file
         with open(file_path, 'w', encoding='utf-8') as f:
@@ -463,8 +566,8 @@ def update_initialize_mappings(file_path: str, code_content: str) -> bool:
         new_content = content[:match.start()] + replacement + content[pos:]
         
         if new_content == content:
-            # print("⚠️  Warning: Could not find InitializeMappings() function to update")
-            return False
+            # Routes unchanged: leave the file (and its timestamp) alone so it is not recompiled
+            return True
         
         # Write back to file
         with open(file_path, 'w', encoding='utf-8') as f:
@@ -524,6 +627,25 @@ Examples:
         help="Show detailed summary of results"
     )
     
+    parser.add_argument(
+        "--project-dir",
+        default=None,
+        help="Client project root that holds the generation cache (default: CMAKE_PROJECT_DIR, then the working directory)"
+    )
+    
+    parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="Parse every file instead of reusing results of unchanged files"
+    )
+    
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=incremental_build.default_jobs(),
+        help="Number of parallel parser processes (default: CPU count)"
+    )
+    
     args = parser.parse_args()
     
     # Show configuration
@@ -546,7 +668,12 @@ Examples:
     # print(f"📁 Found {len(cpp_files)} C++ source files")
     
     # Generate code map (this will also comment out REST macros)
-    code_map = generate_code_map(cpp_files, dry_run=args.dry_run)
+    cache = incremental_build.GenerationCache("L6_generate_code_for_all_sources",
+                                              enabled=incremental_build.cache_enabled(args.no_cache),
+                                              cache_root=args.project_dir)
+    code_map = generate_code_map(cpp_files, dry_run=args.dry_run, cache=cache, jobs=args.jobs)
+    if not args.dry_run:
+        cache.save(keep_paths=cpp_files)
     
     if not code_map:
         # print("⚠️  No files with RestController found. Nothing to update.")
@@ -633,8 +760,15 @@ Examples:
         # print("Error: Failed to add includes to EventDispatcher.h")
         sys.exit(1)
     
-    # Concatenate all code values
-    all_code = '\n\n'.join([info['code'] for info in code_map.values()])
+    # Concatenate all routing table entries into the static route table; singleton
+    # controllers are resolved once ahead of it
+    singleton_controllers = []
+    for info in code_map.values():
+        for interface_name in info.get('singleton_controllers', []):
+            if interface_name not in singleton_controllers:
+                singleton_controllers.append(interface_name)
+    all_code = L5_generate_code_for_file.wrap_route_table('\n\n'.join([info['code'] for info in code_map.values()]),
+                                                          singleton_controllers)
     
     # Update InitializeMappings() function
     if not update_initialize_mappings(dispatcher_file, all_code):
@@ -661,6 +795,8 @@ Examples:
 __all__ = [
     'find_cpp_files',
     'comment_rest_macros',
+    'parse_source_file',
+    'parse_processed_source_file',
     'generate_code_map',
     'generate_includes',
     'add_includes_to_event_dispatcher',
@@ -20,7 +20,8 @@ from typing import Dict, Any
 SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 
 
-def run_l6_generate_code(include_paths: list, exclude_paths: list, dispatcher_file: str, dry_run: bool = False) -> Dict[str, Any]:
+def run_l6_generate_code(include_paths: list, exclude_paths: list, dispatcher_file: str, dry_run: bool = False,
+                         project_dir: str = None) -> Dict[str, Any]:
     """
     Run L6_generate_code_for_all_sources.py.
     
@@ -29,6 +30,7 @@ def run_l6_generate_code(include_paths: list, exclude_paths: list, dispatcher_fi
         exclude_paths: List of exclude paths to avoid
         dispatcher_file: Path to EventDispatcher.h file
         dry_run: Whether to run in dry-run mode
+        project_dir: Client project root (holds the generation cache)
         
     Returns:
         Dictionary with results
@@ -54,6 +56,10 @@ def run_l6_generate_code(include_paths: list, exclude_paths: list, dispatcher_fi
         if dry_run:
             cmd.append("--dry-run")
         
+        # Key the generation cache on the client project, not the working directory
+        if project_dir:
+            cmd.extend(["--project-dir", project_dir])
+        
         # Run the command
         result = subprocess.run(cmd, capture_output=False, text=True, cwd=".")
         
@@ -219,6 +225,12 @@ Examples:
         help="Show what would be changed without making changes"
     )
     
+    parser.add_argument(
+        "--project-dir",
+        default=None,
+        help="Client project root that holds the generation cache"
+    )
+    
     parser.add_argument(
         "--summary",
         action="store_true",
@@ -243,7 +255,8 @@ Examples:
         include_paths=args.include,
         exclude_paths=args.exclude,
         dispatcher_file=args.dispatcher_file,
-        dry_run=args.dry_run
+        dry_run=args.dry_run,
+        project_dir=args.project_dir
     )
     
     # If step 1 failed and not in dry-run, we might want to continue or stop
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+Helpers that let the pre-build generators skip unchanged files and use every core.
+
+- GenerationCache: content-hash cache of per-file results. It is stored as JSON in
+  .springbootplusplus_web_cache/ under the client project root (--project-dir, passed by
+  the pre-build, or CMAKE_PROJECT_DIR), so projects building against one library
+  checkout each keep their own cache. Each entry keeps the SHA-1 of the file contents it was
+  computed from, so an entry is only reused while the file is byte-for-byte unchanged.
+  The whole cache is dropped when any generator script changes, so a library upgrade
+  never reuses stale results.
+- run_in_parallel: maps a function over files with a process or thread pool.
+
+Environment variables (also used when the scripts are started by the pre-build):
+- SPRINGBOOTPLUSPLUS_WEB_NO_CACHE=1: ignore and do not write the cache
+- SPRINGBOOTPLUSPLUS_WEB_JOBS=N: number of parallel workers (default: CPU count)
+"""
+
+import hashlib
+import json
+import os
+import tempfile
+from concurrent.futures import ProcessPoolExecutor, ThreadPoolExecutor
+from pathlib import Path
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+# Directory of this script (the generator scripts whose source versions the cache)
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+CACHE_DIR_NAME = ".springbootplusplus_web_cache"
+NO_CACHE_ENV = "SPRINGBOOTPLUSPLUS_WEB_NO_CACHE"
+JOBS_ENV = "SPRINGBOOTPLUSPLUS_WEB_JOBS"
+# Client project root, set by the CMake integration for the pre-build
+PROJECT_DIR_ENV = "CMAKE_PROJECT_DIR"
+
+# Below this many items a pool costs more to start than it saves
+MIN_ITEMS_FOR_POOL = 8
+
+
+def file_digest(file_path: str) -> Optional[str]:
+    """
+    Compute the SHA-1 of a file's contents.
+
+    Args:
+        file_path: Path to the file
+
+    Returns:
+        Hex digest, or None if the file cannot be read
+    """
+    try:
+        with open(file_path, 'rb') as file:
+            return hashlib.sha1(file.read()).hexdigest()
+    except OSError:
+        return None
+
+
+def scripts_digest() -> str:
+    """
+    Compute a digest over the source of all generator scripts, used as the cache version.
+
+    Returns:
+        Hex digest
+    """
+    digest = hashlib.sha1()
+    for script_path in sorted(Path(SCRIPT_DIR).glob("*.py")):
+        digest.update(script_path.name.encode('utf-8'))
+        try:
+            digest.update(script_path.read_bytes())
+        except OSError:
+            pass
+    return digest.hexdigest()
+
+
+def cache_enabled(no_cache: bool = False) -> bool:
+    """
+    Check whether the generation cache should be used.
+
+    Args:
+        no_cache: True if --no-cache was passed
+
+    Returns:
+        False if disabled by the flag or by SPRINGBOOTPLUSPLUS_WEB_NO_CACHE
+    """
+    if no_cache:
+        return False
+    return os.environ.get(NO_CACHE_ENV, "").strip().lower() not in ("1", "true", "yes")
+
+
+def default_jobs() -> int:
+    """
+    Get the default number of parallel workers.
+
+    Returns:
+        SPRINGBOOTPLUSPLUS_WEB_JOBS if set to a positive number, otherwise the CPU count
+    """
+    try:
+        jobs = int(os.environ.get(JOBS_ENV, "0"))
+    except ValueError:
+        jobs = 0
+    if jobs > 0:
+        return jobs
+    return os.cpu_count() or 1
+
+
+def default_cache_root() -> str:
+    """
+    Get the directory that holds the cache directory when none is given.
+
+    Returns:
+        CMAKE_PROJECT_DIR if set, otherwise the working directory
+    """
+    project_dir = os.environ.get(PROJECT_DIR_ENV, "").strip()
+    return project_dir if project_dir else os.getcwd()
+
+
+def run_in_parallel(function: Callable[[Any], Any], items: List[Any], jobs: int, use_processes: bool = True) -> List[Any]:
+    """
+    Apply a function to every item, in parallel when worthwhile.
+
+    Args:
+        function: Module-level function (it must be picklable for the process pool)
+        items: Items to process
+        jobs: Number of workers (1 = run serially in this process)
+        use_processes: True for CPU-bound work (parsing), False for work that waits on
+                       subprocesses or I/O
+
+    Returns:
+        Results in the order of items
+    """
+    if jobs <= 1 or len(items) < MIN_ITEMS_FOR_POOL:
+        return [function(item) for item in items]
+
+    workers = min(jobs, len(items))
+    try:
+        executor = ProcessPoolExecutor(max_workers=workers) if use_processes else ThreadPoolExecutor(max_workers=workers)
+        with executor:
+            return list(executor.map(function, items))
+    except (OSError, NotImplementedError):
+        # No process support on this host (e.g. restricted sandbox): fall back to serial
+        return [function(item) for item in items]
+
+
+class GenerationCache:
+    """
+    Per-file results of one generator, keyed by absolute path and content digest.
+    """
+
+    def __init__(self, name: str, enabled: bool = True, cache_root: Optional[str] = None):
+        """
+        Load the cache of a generator.
+
+        Args:
+            name: Generator name, used as the cache file name
+            enabled: False to make every lookup miss and save() a no-op
+            cache_root: Client project root that holds the cache directory
+                        (default: default_cache_root())
+        """
+        self.enabled = enabled
+        self.cache_dir = Path(cache_root if cache_root else default_cache_root()).resolve() / CACHE_DIR_NAME
+        self.cache_file = self.cache_dir / f"{name}.json"
+        self.version = scripts_digest() if enabled else ""
+        self.entries: Dict[str, Dict[str, Any]] = {}
+        self.hits = 0
+        self.misses = 0
+        if enabled:
+            self._load()
+
+    def _load(self):
+        try:
+            with open(self.cache_file, 'r', encoding='utf-8') as file:
+                data = json.load(file)
+            if data.get('version') == self.version and isinstance(data.get('entries'), dict):
+                self.entries = data['entries']
+        except (OSError, ValueError):
+            self.entries = {}
+
+    def get(self, file_path: str, digest: Optional[str]) -> Tuple[bool, Any]:
+        """
+        Look up the result computed for a file's current contents.
+
+        Args:
+            file_path: Path to the file
+            digest: Current content digest (from file_digest)
+
+        Returns:
+            (True, result) on a hit, (False, None) otherwise
+        """
+        if not self.enabled or digest is None:
+            return False, None
+        entry = self.entries.get(str(Path(file_path).resolve()))
+        if entry is not None and entry.get('digest') == digest:
+            self.hits += 1
+            return True, entry.get('result')
+        self.misses += 1
+        return False, None
+
+    def put(self, file_path: str, digest: Optional[str], result: Any):
+        """
+        Record the result for a file's contents.
+
+        Args:
+            file_path: Path to the file
+            digest: Digest of the contents the result belongs to (after any rewrite
+                    the generator made to the file)
+            result: JSON-serializable result
+        """
+        if not self.enabled or digest is None:
+            return
+        self.entries[str(Path(file_path).resolve())] = {'digest': digest, 'result': result}
+
+    def save(self, keep_paths: Optional[List[str]] = None):
+        """
+        Write the cache atomically.
+
+        Args:
+            keep_paths: If given, entries of files not in this list (deleted or no longer
+                        scanned) are dropped
+        """
+        if not self.enabled:
+            return
+        if keep_paths is not None:
+            keep = {str(Path(path).resolve()) for path in keep_paths}
+            self.entries = {path: entry for path, entry in self.entries.items() if path in keep}
+        try:
+            self.cache_dir.mkdir(parents=True, exist_ok=True)
+            # The cache is machine-local build state: keep it out of version control
+            ignore_file = self.cache_dir / ".gitignore"
+            if not ignore_file.exists():
+                ignore_file.write_text("*\n", encoding='utf-8')
+            fd, temp_path = tempfile.mkstemp(dir=str(self.cache_dir), suffix=".tmp")
+            with os.fdopen(fd, 'w', encoding='utf-8') as file:
+                json.dump({'version': self.version, 'entries': self.entries}, file)
+            os.replace(temp_path, self.cache_file)
+        except OSError:
+            # A read-only or missing project directory only costs the next build its cache
+            pass
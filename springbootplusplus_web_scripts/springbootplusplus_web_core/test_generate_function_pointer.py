@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+Test script for generate_function_pointer_advanced()
+"""
+
+import sys
+import os
+
+# Add current directory to path
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from L3_get_endpoint_details import parse_function_signature_advanced, find_cacheable_ttl
+from L4_generate_function_pointer import generate_function_pointer_advanced
+
+# Test cases: (signature, URL, lines the generated code must contain)
+test_cases = [
+    # Test 1: PathVariables typed with the repo's const typedefs
+    ("Void GetUser(/* @PathVariable(\"name\") */ CStdString name, /* @PathVariable(\"id\") */ CInt id) {",
+     "/user/{name}/{id}",
+     ["std::remove_cv_t<CStdString> pathVariable0{};",
+      "TryConvertToType<std::remove_cv_t<CStdString>>(context.GetPathVariable(\"name\"), pathVariable0, context.GetArena())",
+      "std::remove_cv_t<CInt> pathVariable1{};",
+      "TryConvertToType<std::remove_cv_t<CInt>>(context.GetPathVariable(\"id\"), pathVariable1, context.GetArena())"]),
+    
+    # Test 2: 'const' and reference PathVariables
+    ("Void GetItem(/* @PathVariable(\"id\") */ const int id, /* @PathVariable(\"tag\") */ const StdString& tag) {",
+     "/item/{id}/{tag}",
+     ["std::remove_cv_t<int> pathVariable0{};",
+      "std::remove_cv_t<StdString> pathVariable1{};"]),
+    
+    # Test 3: RequestParams typed with the repo's const typedefs
+    ("Void ListUsers(/* @RequestParam(\"page\") */ CInt page, /* @RequestParam */ CStdString sort) {",
+     "/users",
+     ["std::remove_cv_t<CInt> requestParam0{};",
+      "TryConvertToType<std::remove_cv_t<CInt>>(rawRequestParam0, requestParam0, context.GetArena())",
+      "std::remove_cv_t<CStdString> requestParam1{};",
+      "TryConvertToType<std::remove_cv_t<CStdString>>(rawRequestParam1, requestParam1, context.GetArena())"]),
+]
+
+print("=" * 80)
+print("Testing generate_function_pointer_advanced()")
+print("=" * 80)
+print()
+
+failures = 0
+for i, (signature, url, expected_lines) in enumerate(test_cases, 1):
+    print(f"Test Case {i}:")
+    print(f"  Input: {signature}")
+    print()
+    
+    parsed = parse_function_signature_advanced(signature)
+    if not parsed:
+        print("  ❌ Failed to parse")
+        failures += 1
+        continue
+    
+    code = generate_function_pointer_advanced({
+        'controller_interface_name': 'IUserController',
+        'complete_url': url,
+        'endpoint_type': 'GET',
+        'return_type': parsed['return_type'],
+        'function_name': parsed['function_name'],
+        'parameters': parsed['parameters'],
+    })
+    # print(code)
+    
+    for line in expected_lines:
+        if line in code:
+            print(f"  ✅ {line}")
+        else:
+            print(f"  ❌ Missing: {line}")
+            failures += 1
+    
+    print()
+    print("-" * 80)
+    print()
+
+# @Cacheable forms: (annotation line, lines the generated code must contain)
+cacheable_cases = [
+    ("/* @Cacheable */", ["}, HttpRouteCacheUntilInvalidated},"]),
+    ("/* @Cacheable(30000) */", ["}, 30000u},"]),
+    ("/* @Cacheable(0) */", ["#error \"@Cacheable(0) on GET /status"]),
+]
+
+print("Testing @Cacheable TTLs")
+print()
+
+for annotation, expected_lines in cacheable_cases:
+    print(f"  Input: {annotation}")
+    lines = [annotation, "/* @GetMapping(\"/status\") */", "StdString GetStatus() {"]
+    code = generate_function_pointer_advanced({
+        'controller_interface_name': 'IStatusController',
+        'complete_url': '/status',
+        'endpoint_type': 'GET',
+        'return_type': 'StdString',
+        'function_name': 'GetStatus',
+        'parameters': [],
+        'cache_ttl_ms': find_cacheable_ttl(lines, 2, 3),
+    })
+    for line in expected_lines:
+        if line in code:
+            print(f"  ✅ {line}")
+        else:
+            print(f"  ❌ Missing: {line}")
+            failures += 1
+    print()
+
+sys.exit(1 if failures else 0)
@@ -27,6 +27,9 @@ test_cases = [
     
     # Test 5: Complex types
     "MyReturnDto GetData(/* @PathVariable(\"id\") */ const int id, /* @RequestBody */ ComplexType<InnerType> data) {",
+    
+    # Test 6: Query parameters (named, and named after the argument)
+    "Void ListUsers(/* @RequestParam(\"page\") */ Int page, /* @RequestParam */ StdString sort) {",
 ]
 
 print("=" * 80)
@@ -115,6 +115,10 @@ def execute_scripts(project_dir, library_dir, all_libs=None, library_scripts_dir
             # print(f"⚠️  Warning: HttpRequestDispatcher.h not found at {dispatcher_file}")
             pass
         
+        # The generation cache belongs to the client project, whatever the working directory
+        if project_dir:
+            cmd.extend(["--project-dir", str(project_dir)])
+        
         # print(f"\nRunning: {' '.join(cmd)}")
         # print(f"Include paths: {include_paths}")
         
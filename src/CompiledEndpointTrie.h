@@ -0,0 +1,471 @@
+#ifndef COMPILED_ENDPOINT_TRIE_H
+#define COMPILED_ENDPOINT_TRIE_H
+
+#include <StandardDefines.h>
+#include "EndpointTrie.h"
+#include "EndpointMatcher.h"
+#include "HttpPipelineDefaults.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string_view>
+#include <vector>
+
+/**
+ * Read-only, deterministic form of an EndpointTrie used for lookups once all routes are
+ * registered
+ *
+ * Compile() merges sibling variable nodes whatever their names ("/api/{a}/x" and
+ * "/api/{b}/y" share one variable edge) and determinizes the result: every literal edge
+ * also carries the patterns that would have matched the segment through a variable, so a
+ * lookup follows at most one edge per segment and never backtracks - O(segments), each
+ * step a binary search over the node's literal edges.
+ *
+ * Each node keeps, per method, the most specific endpoint among the patterns that reach
+ * it. Specificity compares patterns segment by segment: at the first difference, a literal
+ * segment beats a variable ("/api/{id}/x" beats "/api/{a}/{b}"). Variable names only
+ * matter once a route is chosen: every endpoint has its own capture table (segment index
+ * -> name). Two patterns with the same shape and method ("/api/{a}" and "/api/{b}") are a
+ * conflict; the pre-build rejects them, and here the first one in name order wins.
+ *
+ * As in EndpointTrie, a trailing slash only matches an endpoint reached without consuming
+ * any variable, and an endpoint without a route for the method sets methodMismatch.
+ * Indices are 32-bit, so the whole structure is a handful of heap blocks.
+ */
+class CompiledEndpointTrie {
+    Private
+        static constexpr UInt32 NoIndex = UINT32_MAX;
+
+        struct Edge {
+            UInt32 labelOffset;  // Literal segment in the arena
+            UInt32 labelLength;
+            UInt32 child;        // Target node index
+        };
+
+        struct Node {
+            UInt32 edgeBegin;           // Literal edges, sorted for FindLiteral
+            UInt32 edgeCount;
+            UInt32 variableChild;       // Any other non-empty segment, NoIndex if none
+            UInt32 routeBegin;          // Most specific entry per method, most specific first
+            UInt16 routeCount;
+            UInt16 literalRouteCount;   // Entries of the all-literal endpoint (trailing slash),
+            UInt32 literalRouteBegin;   // which is always the first candidate when it exists
+        };
+
+        /**
+         * One route of one source endpoint, with its own variable positions
+         */
+        struct Entry {
+            const HttpRoute* route;
+            UInt32 patternOffset;
+            UInt32 patternLength;
+            UInt32 captureBegin;
+            UInt32 captureCount;
+        };
+
+        struct Capture {
+            UInt32 segment;       // Index of the captured path segment
+            UInt32 nameOffset;    // Variable name in the arena
+            UInt32 nameLength;
+        };
+
+        StdVector<Node> nodes;
+        StdVector<Edge> edges;
+        StdVector<UInt32> nodeEntries;
+        StdVector<Entry> entries;
+        StdVector<Capture> captures;
+        StdString arena;
+        Size conflictCount = 0;
+
+        // ============================================================================
+        // Compilation
+        // ============================================================================
+
+        /**
+         * Source endpoint facts gathered by a walk over the mutable trie
+         */
+        struct SourceInfo {
+            StdVector<std::pair<UInt32, StdString>> variables;  // (segment index, name)
+            Bool literalPath;                                   // Reached through literal edges only
+        };
+
+        // Equally specific source nodes (same shape so far), most specific group first
+        using Group = StdVector<const EndpointTrieNode*>;
+        using State = StdVector<Group>;
+
+        std::string_view ArenaView(UInt32 offset, UInt32 length) const {
+            return std::string_view(arena.data() + offset, length);
+        }
+
+        /**
+         * Literal edge order: by length, then bytes. Most comparisons during the binary
+         * search are decided by the length alone.
+         */
+        Bool LabelLess(const Edge& edge, std::string_view value) const {
+            if (edge.labelLength != value.length()) {
+                return edge.labelLength < value.length();
+            }
+            return ArenaView(edge.labelOffset, edge.labelLength) < value;
+        }
+
+        /**
+         * Store a string in the arena once and return its offset
+         */
+        static UInt32 Intern(StdString& arena, StdMap<StdString, UInt32>& interned, const StdString& value) {
+            auto it = interned.find(value);
+            if (it != interned.end()) {
+                return it->second;
+            }
+            UInt32 offset = static_cast<UInt32>(arena.size());
+            arena.append(value);
+            interned[value] = offset;
+            return offset;
+        }
+
+        /**
+         * Record the captures (segment index, name) of every node, and whether it is
+         * reached through literal edges only
+         */
+        static Void CollectSources(const EndpointTrieNode* node, UInt32 depth, const SourceInfo& info,
+                                   StdMap<const EndpointTrieNode*, SourceInfo>& sources) {
+            sources[node] = info;
+            for (const auto& pair : node->GetLiteralChildren()) {
+                CollectSources(pair.second, depth + 1, info, sources);
+            }
+            for (const auto& pair : node->GetVariableChildren()) {
+                SourceInfo child = info;
+                child.variables.emplace_back(depth, pair.first);
+                child.literalPath = false;
+                CollectSources(pair.second, depth + 1, child, sources);
+            }
+        }
+
+        /**
+         * Successor state for a literal segment (label != nullptr) or for any other
+         * segment (label == nullptr). Within each group, the literal child is more specific
+         * than the variable children, and every group stays ahead of the less specific ones.
+         */
+        static State Advance(const State& state, const StdString* label) {
+            State next;
+            for (const Group& group : state) {
+                if (label != nullptr) {
+                    Group literals;
+                    for (const EndpointTrieNode* node : group) {
+                        const EndpointTrieNode* child = node->GetLiteralChild(*label);
+                        if (child != nullptr) {
+                            literals.push_back(child);
+                        }
+                    }
+                    if (!literals.empty()) {
+                        next.push_back(std::move(literals));
+                    }
+                }
+                Group variables;
+                for (const EndpointTrieNode* node : group) {
+                    for (const auto& pair : node->GetVariableChildren()) {
+                        variables.push_back(pair.second);
+                    }
+                }
+                if (!variables.empty()) {
+                    next.push_back(std::move(variables));
+                }
+            }
+            return next;
+        }
+
+        UInt32 EntryFor(const EndpointTrieNode* node, CSize methodIndex, const SourceInfo& info,
+                        StdMap<std::pair<const EndpointTrieNode*, Size>, UInt32>& entryIndex,
+                        StdMap<StdString, UInt32>& interned) {
+            auto key = std::make_pair(node, methodIndex);
+            auto it = entryIndex.find(key);
+            if (it != entryIndex.end()) {
+                return it->second;
+            }
+            const StdString& pattern = node->GetEndpointPattern();
+            Entry entry{node->GetRoute(methodIndex), Intern(arena, interned, pattern),
+                        static_cast<UInt32>(pattern.size()), static_cast<UInt32>(captures.size()),
+                        static_cast<UInt32>(info.variables.size())};
+            for (const auto& variable : info.variables) {
+                captures.push_back(Capture{variable.first, Intern(arena, interned, variable.second),
+                                           static_cast<UInt32>(variable.second.size())});
+            }
+            UInt32 index = static_cast<UInt32>(entries.size());
+            entries.push_back(entry);
+            entryIndex[key] = index;
+            return index;
+        }
+
+        /**
+         * Pick the most specific entry per method among the endpoints of a state
+         */
+        Void AssignEndpoints(const State& state, Node& node,
+                             const StdMap<const EndpointTrieNode*, SourceInfo>& sources,
+                             StdMap<std::pair<const EndpointTrieNode*, Size>, UInt32>& entryIndex,
+                             StdMap<StdString, UInt32>& interned) {
+            node.routeBegin = static_cast<UInt32>(nodeEntries.size());
+            Size assignedGroup[HttpMethodCount];
+            for (Size m = 0; m < HttpMethodCount; m++) {
+                assignedGroup[m] = SIZE_MAX;
+            }
+            for (Size g = 0; g < state.size(); g++) {
+                for (const EndpointTrieNode* source : state[g]) {
+                    const SourceInfo& info = sources.at(source);
+                    // Beyond HTTP_ROUTE_MAX_VARIABLES a pattern can never be matched
+                    if (!source->IsEndpoint() || info.variables.size() > HTTP_ROUTE_MAX_VARIABLES) {
+                        continue;
+                    }
+                    for (Size m = 0; m < HttpMethodCount; m++) {
+                        if (source->GetRoute(m) == nullptr) {
+                            continue;
+                        }
+                        if (assignedGroup[m] == SIZE_MAX) {
+                            assignedGroup[m] = g;
+                            nodeEntries.push_back(EntryFor(source, m, info, entryIndex, interned));
+                        } else if (assignedGroup[m] == g) {
+                            conflictCount++;  // Same shape and method under another variable name
+                        }
+                    }
+                }
+            }
+            node.routeCount = static_cast<UInt16>(nodeEntries.size() - node.routeBegin);
+
+            // The all-literal endpoint, if any, is the only node of the first group
+            node.literalRouteBegin = static_cast<UInt32>(nodeEntries.size());
+            if (!state.empty() && state[0].size() == 1 && state[0][0]->IsEndpoint() &&
+                sources.at(state[0][0]).literalPath) {
+                const EndpointTrieNode* source = state[0][0];
+                for (Size m = 0; m < HttpMethodCount; m++) {
+                    if (source->GetRoute(m) != nullptr) {
+                        nodeEntries.push_back(EntryFor(source, m, sources.at(source), entryIndex, interned));
+                    }
+                }
+            }
+            node.literalRouteCount = static_cast<UInt16>(nodeEntries.size() - node.literalRouteBegin);
+        }
+
+        UInt32 FindLiteral(const Node& node, std::string_view segment) const {
+            const Edge* first = edges.data() + node.edgeBegin;
+            const Edge* last = first + node.edgeCount;
+            const Edge* it = std::lower_bound(first, last, segment, [this](const Edge& edge, std::string_view value) {
+                return LabelLess(edge, value);
+            });
+            if (it != last && ArenaView(it->labelOffset, it->labelLength) == segment) {
+                return it->child;
+            }
+            return NoIndex;
+        }
+
+        /**
+         * Fill the match from the first entry of a candidate slice with the method
+         */
+        Bool MatchEntries(UInt32 begin, UInt32 count, Size methodIndex, const std::string_view* segments,
+                          std::string_view path, EndpointMatch& match) const {
+            for (UInt32 i = 0; i < count; i++) {
+                const Entry& entry = entries[nodeEntries[begin + i]];
+                if (methodIndex != EndpointAnyMethod) {
+                    if (HttpMethodIndex(entry.route->method) != methodIndex) {
+                        continue;
+                    }
+                    match.route = entry.route;
+                }
+                match.pattern = ArenaView(entry.patternOffset, entry.patternLength);
+                match.captureCount = entry.captureCount;
+                for (UInt32 c = 0; c < entry.captureCount; c++) {
+                    const Capture& capture = captures[entry.captureBegin + c];
+                    std::string_view segment = segments[capture.segment];
+                    match.captures[c] = EndpointCapture{ArenaView(capture.nameOffset, capture.nameLength),
+                                                        static_cast<Size>(segment.data() - path.data()),
+                                                        segment.length()};
+                }
+                match.found = true;
+                return true;
+            }
+            // Pattern matches, method does not
+            match.methodMismatch = count > 0;
+            return false;
+        }
+
+        EndpointMatch MatchIndex(std::string_view path, CSize methodIndex) const {
+            EndpointMatch match;
+            if (nodes.empty()) {
+                return match;
+            }
+            std::string_view segments[HTTP_ROUTE_MAX_SEGMENTS];
+            Size segmentCount = 0;
+            if (!EndpointMatcher<EndpointTrie::Layout>::SplitPath(path, segments, segmentCount)) {
+                return match;  // Longer than any route we accept
+            }
+            CBool trailingSlash = segmentCount > 0 && segments[segmentCount - 1].empty();
+            CSize count = trailingSlash ? segmentCount - 1 : segmentCount;
+
+            UInt32 current = 0;
+            for (Size i = 0; i < count; i++) {
+                const Node& node = nodes[current];
+                UInt32 next = FindLiteral(node, segments[i]);
+                current = next != NoIndex ? next : node.variableChild;
+                if (current == NoIndex) {
+                    return match;
+                }
+            }
+
+            const Node& node = nodes[current];
+            if (trailingSlash) {
+                MatchEntries(node.literalRouteBegin, node.literalRouteCount, methodIndex, segments, path, match);
+            } else {
+                MatchEntries(node.routeBegin, node.routeCount, methodIndex, segments, path, match);
+            }
+            return match;
+        }
+
+    Public
+        CompiledEndpointTrie() = default;
+
+        /**
+         * Rebuild the deterministic layout from a fully populated trie. The trie can be
+         * cleared afterwards; routes must keep living (generated routes are in a static table).
+         *
+         * @param trie The trie to compile
+         */
+        Void Compile(const EndpointTrie& trie) {
+            Clear();
+
+            StdMap<const EndpointTrieNode*, SourceInfo> sources;
+            CollectSources(trie.GetRoot(), 0, SourceInfo{{}, true}, sources);
+
+            StdMap<StdString, UInt32> interned;
+            StdMap<std::pair<const EndpointTrieNode*, Size>, UInt32> entryIndex;
+            StdMap<State, UInt32> stateIndex;
+            std::deque<State> pending;
+
+            State start{Group{trie.GetRoot()}};
+            stateIndex[start] = 0;
+            pending.push_back(start);
+            nodes.push_back(Node{0, 0, NoIndex, 0, 0, 0, 0});
+
+            auto stateFor = [&](State&& state) -> UInt32 {
+                if (state.empty()) {
+                    return NoIndex;
+                }
+                auto it = stateIndex.find(state);
+                if (it != stateIndex.end()) {
+                    return it->second;
+                }
+                UInt32 index = static_cast<UInt32>(nodes.size());
+                nodes.push_back(Node{0, 0, NoIndex, 0, 0, 0, 0});
+                stateIndex.emplace(state, index);
+                pending.push_back(std::move(state));
+                return index;
+            };
+
+            // States are laid out in discovery (breadth-first) order
+            for (UInt32 current = 0; !pending.empty(); current++) {
+                State state = std::move(pending.front());
+                pending.pop_front();
+
+                StdVector<StdString> labels;
+                for (const Group& group : state) {
+                    for (const EndpointTrieNode* source : group) {
+                        for (const auto& pair : source->GetLiteralChildren()) {
+                            // Trailing-slash patterns ("/a/") end in an empty literal that
+                            // no segment reaches: "/a/" is matched at the "a" node
+                            if (!pair.first.empty()) {
+                                labels.push_back(pair.first);
+                            }
+                        }
+                    }
+                }
+                std::sort(labels.begin(), labels.end());
+                labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+                Node node{static_cast<UInt32>(edges.size()), 0, NoIndex, 0, 0, 0, 0};
+                for (const StdString& label : labels) {
+                    // Interned before the child is created: edges of several nodes interleave
+                    UInt32 labelOffset = Intern(arena, interned, label);
+                    UInt32 child = stateFor(Advance(state, &label));
+                    edges.push_back(Edge{labelOffset, static_cast<UInt32>(label.size()), child});
+                }
+                node.edgeCount = static_cast<UInt32>(edges.size() - node.edgeBegin);
+                node.variableChild = stateFor(Advance(state, nullptr));
+
+                // Re-sort the literal slice into the order FindLiteral searches
+                Edge* literalBegin = edges.data() + node.edgeBegin;
+                std::sort(literalBegin, literalBegin + node.edgeCount, [this](const Edge& a, const Edge& b) {
+                    return LabelLess(a, ArenaView(b.labelOffset, b.labelLength));
+                });
+
+                AssignEndpoints(state, node, sources, entryIndex, interned);
+                nodes[current] = node;
+            }
+
+            // Drop the growth slack; nothing is inserted after compilation
+            nodes.shrink_to_fit();
+            edges.shrink_to_fit();
+            nodeEntries.shrink_to_fit();
+            entries.shrink_to_fit();
+            captures.shrink_to_fit();
+            arena.shrink_to_fit();
+        }
+
+        /**
+         * Search for the most specific route of a method matching the path.
+         * Variables are slices of path, which must outlive the result.
+         *
+         * @param path The actual path to match
+         * @param method The request method
+         * @return EndpointMatch with route and captures when found
+         */
+        EndpointMatch Match(std::string_view path, HttpMethod method) const {
+            return MatchIndex(path, HttpMethodIndex(method));
+        }
+
+        /**
+         * Pattern-only search, ignoring methods
+         */
+        EndpointMatch Match(std::string_view path) const {
+            return MatchIndex(path, EndpointAnyMethod);
+        }
+
+        /**
+         * Number of compiled nodes (the root included)
+         */
+        Size GetNodeCount() const {
+            return nodes.size();
+        }
+
+        /**
+         * Routes shadowed by another route with the same shape and method (e.g.
+         * "/api/{a}" and "/api/{b}"); the pre-build refuses such tables
+         */
+        Size GetConflictCount() const {
+            return conflictCount;
+        }
+
+        /**
+         * Heap bytes held by the compiled layout
+         */
+        Size GetMemoryUsage() const {
+            return nodes.capacity() * sizeof(Node) +
+                   edges.capacity() * sizeof(Edge) +
+                   nodeEntries.capacity() * sizeof(UInt32) +
+                   entries.capacity() * sizeof(Entry) +
+                   captures.capacity() * sizeof(Capture) +
+                   arena.capacity();
+        }
+
+        Bool IsEmpty() const {
+            return entries.empty();
+        }
+
+        Void Clear() {
+            nodes.clear();
+            edges.clear();
+            nodeEntries.clear();
+            entries.clear();
+            captures.clear();
+            arena.clear();
+            conflictCount = 0;
+        }
+};
+
+#endif // COMPILED_ENDPOINT_TRIE_H
@@ -0,0 +1,255 @@
+#ifndef ENDPOINT_MATCHER_H
+#define ENDPOINT_MATCHER_H
+
+#include <StandardDefines.h>
+#include "HttpRoute.h"
+#include "HttpPipelineDefaults.h"
+#include <string_view>
+
+/**
+ * A path variable captured during matching, as a slice of the request path
+ */
+struct EndpointCapture {
+    std::string_view name;  // Variable name, owned by the trie (e.g., "userId")
+    Size offset;            // Start of the value in the matched path
+    Size length;            // Length of the value
+};
+
+/**
+ * Allocation-free match result: the route plus variable slices into the request path.
+ * Strings are only built when ToVariables()/GetVariable() is called, and the path that
+ * was matched must still be alive at that point.
+ */
+struct EndpointMatch {
+    const HttpRoute* route;  // Route for the requested method (nullptr for pattern-only search)
+    std::string_view pattern;  // Matched endpoint pattern, owned by the trie
+    Size captureCount;
+    EndpointCapture captures[HTTP_ROUTE_MAX_VARIABLES];
+    Bool found;
+    Bool methodMismatch;  // Not found, but some pattern matched the path for another method
+
+    EndpointMatch() : route(nullptr), captureCount(0), captures(), found(false), methodMismatch(false) {}
+
+    /**
+     * Value of a captured variable as a view into path, empty if not captured
+     */
+    std::string_view GetVariable(std::string_view path, std::string_view name) const {
+        for (Size i = 0; i < captureCount; i++) {
+            if (captures[i].name == name) {
+                return path.substr(captures[i].offset, captures[i].length);
+            }
+        }
+        return std::string_view();
+    }
+
+    /**
+     * Materialize the captures as a name -> value map
+     */
+    StdMap<StdString, StdString> ToVariables(std::string_view path) const {
+        StdMap<StdString, StdString> variables;
+        for (Size i = 0; i < captureCount; i++) {
+            variables[StdString(captures[i].name)] = StdString(path.substr(captures[i].offset, captures[i].length));
+        }
+        return variables;
+    }
+};
+
+// Method index meaning "any method" (pattern-only search)
+static constexpr Size EndpointAnyMethod = HttpMethodCount;
+
+/**
+ * Backtracking route matching over the mutable EndpointTrie (CompiledEndpointTrie walks
+ * a determinized layout instead and only reuses SplitPath). The Layout supplies node access:
+ *
+ *   NodeRef Root() const;
+ *   Bool IsNull(NodeRef node) const;
+ *   NodeRef FindLiteral(NodeRef node, std::string_view segment) const;
+ *   template<typename F> Bool ForEachVariable(NodeRef node, F&& f) const;  // f(name, child) -> stop
+ *   Bool HasVariables(NodeRef node) const;
+ *   Bool IsEndpoint(NodeRef node) const;
+ *   const HttpRoute* GetRoute(NodeRef node, Size methodIndex) const;
+ *   std::string_view GetPattern(NodeRef node) const;
+ *
+ * Matching rules: literal segments win over variables, variables are tried in name order
+ * with backtracking, and a trailing slash only matches an endpoint reached without
+ * consuming any variable. Sibling variables with different names are separate branches,
+ * so "/api/{b}/{c}" can win over "/api/{a}/x"; the compiled trie merges them and picks
+ * the most specific pattern.
+ */
+template<typename Layout>
+class EndpointMatcher {
+    Private
+        using NodeRef = typename Layout::NodeRef;
+
+        /**
+         * Read-only state shared by one match
+         */
+        struct MatchContext {
+            const Layout& layout;
+            std::string_view path;
+            const std::string_view* segments;
+            Size segmentCount;
+            Size methodIndex;
+        };
+
+        /**
+         * Check whether the node completes a match for the requested method.
+         * An endpoint without a route for the method is not a match, so the search keeps
+         * backtracking into other patterns; methodMismatch remembers that the path itself matched.
+         */
+        static Bool MatchEndpoint(NodeRef node, const MatchContext& context, EndpointMatch& match) {
+            if (!context.layout.IsEndpoint(node)) {
+                return false;
+            }
+            if (context.methodIndex != EndpointAnyMethod) {
+                const HttpRoute* route = context.layout.GetRoute(node, context.methodIndex);
+                if (route == nullptr) {
+                    match.methodMismatch = true;
+                    return false;  // Pattern matches, method does not
+                }
+                match.route = route;
+            }
+            match.pattern = context.layout.GetPattern(node);
+            match.found = true;
+            return true;
+        }
+
+        /**
+         * Try every variable child for the current segment, backtracking on failure
+         */
+        static Bool MatchVariables(NodeRef node, const MatchContext& context, Size index, EndpointMatch& match) {
+            if (!context.layout.HasVariables(node) || match.captureCount >= HTTP_ROUTE_MAX_VARIABLES) {
+                return false;
+            }
+            std::string_view segment = context.segments[index];
+            EndpointCapture& capture = match.captures[match.captureCount];
+            capture.offset = static_cast<Size>(segment.data() - context.path.data());
+            capture.length = segment.length();
+            return context.layout.ForEachVariable(node, [&](std::string_view name, NodeRef child) {
+                capture.name = name;
+                match.captureCount++;
+                if (MatchRecursive(child, context, index + 1, match)) {
+                    return true;
+                }
+                // Backtrack: drop the variable we just tried
+                match.captureCount--;
+                return false;
+            });
+        }
+
+        /**
+         * Recursive match helper; captures live in match, nothing is allocated
+         */
+        static Bool MatchRecursive(NodeRef node, const MatchContext& context, Size index, EndpointMatch& match) {
+            // If we've processed all segments
+            if (index >= context.segmentCount) {
+                return MatchEndpoint(node, context, match);
+            }
+
+            std::string_view currentSegment = context.segments[index];
+
+            // Special handling for empty segment (trailing slash)
+            // If we encounter an empty segment, prefer exact endpoint match over variable match
+            // This handles the case where /xyz/ should match /xyz instead of /xyz/{ssid}
+            if (currentSegment.empty()) {
+                // If we're at the last segment (trailing slash at end of path)
+                if (index + 1 >= context.segmentCount) {
+                    // Only match if current node is an endpoint AND we haven't consumed any variables
+                    // This ensures:
+                    // - /xyz/ matches /xyz (exact literal match, no variables consumed)
+                    // - /api/user/123/ does NOT match /api/user/{userId} (variable was consumed)
+                    if (match.captureCount == 0) {
+                        return MatchEndpoint(node, context, match);
+                    }
+                    return false;  // No match - trailing slash doesn't match pattern
+                }
+                // If there are more segments after the empty one, try variable match
+                return MatchVariables(node, context, index, match);
+            }
+
+            // For non-empty segments, try literal match first
+            NodeRef literalChild = context.layout.FindLiteral(node, currentSegment);
+            if (!context.layout.IsNull(literalChild) && MatchRecursive(literalChild, context, index + 1, match)) {
+                return true;
+            }
+
+            // Try variable match (try all variable children)
+            return MatchVariables(node, context, index, match);
+        }
+
+    Public
+        /**
+         * Split a path into segment views without copying
+         * "/api/user/create" -> ["api", "user", "create"]
+         * "/api/user/123/" -> ["api", "user", "123", ""] (empty segment for trailing slash)
+         * "/api//user" -> ["api", "user"] (empty segments from // are filtered out)
+         *
+         * @return false if the path has more than HTTP_ROUTE_MAX_SEGMENTS segments
+         */
+        static Bool SplitPath(std::string_view path, std::string_view* segments, Size& count) {
+            count = 0;
+            if (path.empty() || path == "/") {
+                return true;
+            }
+
+            // Remove leading slash
+            if (path[0] == '/') {
+                path.remove_prefix(1);
+            }
+
+            // Remove trailing slash, remembered as an empty last segment
+            Bool hasTrailingSlash = !path.empty() && path.back() == '/';
+            if (hasTrailingSlash) {
+                path.remove_suffix(1);
+            }
+
+            size_t start = 0;
+            while (start < path.length()) {
+                size_t pos = path.find('/', start);
+                size_t end = pos == std::string_view::npos ? path.length() : pos;
+                // Only add non-empty segments (handles multiple slashes like "//")
+                if (end > start) {
+                    if (count >= HTTP_ROUTE_MAX_SEGMENTS) {
+                        return false;
+                    }
+                    segments[count++] = path.substr(start, end - start);
+                }
+                if (pos == std::string_view::npos) {
+                    break;
+                }
+                start = pos + 1;
+            }
+
+            if (hasTrailingSlash) {
+                if (count >= HTTP_ROUTE_MAX_SEGMENTS) {
+                    return false;
+                }
+                // Empty view positioned at the end of the path
+                segments[count++] = path.substr(path.length());
+            }
+            return true;
+        }
+
+        /**
+         * Match a path; path must outlive the returned captures
+         *
+         * @param layout Node access for the trie being searched
+         * @param path The actual path to match
+         * @param methodIndex HttpMethodIndex of the request method, or EndpointAnyMethod
+         */
+        static EndpointMatch Match(const Layout& layout, std::string_view path, Size methodIndex) {
+            EndpointMatch match;
+            std::string_view segments[HTTP_ROUTE_MAX_SEGMENTS];
+            Size segmentCount = 0;
+            if (!SplitPath(path, segments, segmentCount)) {
+                return match;  // Longer than any route we accept
+            }
+            MatchContext context{layout, path, segments, segmentCount, methodIndex};
+            if (!MatchRecursive(layout.Root(), context, 0, match)) {
+                match.captureCount = 0;
+            }
+            return match;
+        }
+};
+
+#endif // ENDPOINT_MATCHER_H
@@ -2,8 +2,11 @@
 #define ENDPOINT_TRIE_H
 
 #include <StandardDefines.h>
+#include "HttpRoute.h"
+#include "EndpointMatcher.h"
 #include <map>
 #include <vector>
+#include <string_view>
 
 /**
  * Result structure returned when matching an endpoint
@@ -12,10 +15,12 @@ struct EndpointMatchResult {
     StdString pattern;  // The matched endpoint pattern (e.g., "/api/user/{userId}/get")
     StdMap<StdString, StdString> variables;  // Map of variable names to values (e.g., {"userId": "123"})
     Bool found;  // Whether a match was found
+    const HttpRoute* route;  // Route registered for the requested method (method-aware search only)
+    Bool methodMismatch;  // Not found, but some pattern matched the path for another method
     
-    EndpointMatchResult() : found(false) {}
+    EndpointMatchResult() : found(false), route(nullptr), methodMismatch(false) {}
     EndpointMatchResult(const StdString& pat, const StdMap<StdString, StdString>& vars) 
-        : pattern(pat), variables(vars), found(true) {}
+        : pattern(pat), variables(vars), found(true), route(nullptr), methodMismatch(false) {}
 };
 
 /**
@@ -24,11 +29,12 @@ struct EndpointMatchResult {
 class EndpointTrieNode {
     Private
         // Children for literal path segments (e.g., "user", "api")
-        StdMap<StdString, EndpointTrieNode*> literalChildren;
+        // std::less<> allows lookups by string_view without building a StdString
+        std::map<StdString, EndpointTrieNode*, std::less<>> literalChildren;
         
         // Child for variable path segments (e.g., "{userId}")
         // Stores the variable name and the child node
-        StdMap<StdString, EndpointTrieNode*> variableChildren;  // key: variable name, value: child node
+        std::map<StdString, EndpointTrieNode*, std::less<>> variableChildren;  // key: variable name, value: child node
         
         // Endpoint pattern stored at this node (if this is a leaf)
         StdString endpointPattern;
@@ -38,9 +44,12 @@ class EndpointTrieNode {
         
         // Count of literal children (for IsEmpty check)
         Size literalChildrenCount;
+        
+        // Route per HTTP method (indexed by HttpMethodIndex), nullptr if not registered
+        const HttpRoute* routes[HttpMethodCount];
 
     Public
-        EndpointTrieNode() : isEndpoint(false), literalChildrenCount(0) {}
+        EndpointTrieNode() : isEndpoint(false), literalChildrenCount(0), routes() {}
         
         ~EndpointTrieNode() {
             // Clean up literal children
@@ -71,7 +80,7 @@ class EndpointTrieNode {
         }
         
         // Get literal child if exists
-        EndpointTrieNode* GetLiteralChild(const StdString& segment) const {
+        EndpointTrieNode* GetLiteralChild(std::string_view segment) const {
             auto it = literalChildren.find(segment);
             if (it != literalChildren.end()) {
                 return it->second;
@@ -79,8 +88,13 @@ class EndpointTrieNode {
             return nullptr;
         }
         
+        // Get all literal children (sorted by segment)
+        const std::map<StdString, EndpointTrieNode*, std::less<>>& GetLiteralChildren() const {
+            return literalChildren;
+        }
+        
         // Get all variable children (for matching)
-        const StdMap<StdString, EndpointTrieNode*>& GetVariableChildren() const {
+        const std::map<StdString, EndpointTrieNode*, std::less<>>& GetVariableChildren() const {
             return variableChildren;
         }
         
@@ -90,8 +104,18 @@ class EndpointTrieNode {
             isEndpoint = true;
         }
         
+        // Attach a route for its method (the node must be the pattern's endpoint)
+        Void SetRoute(const HttpRoute* route) {
+            routes[HttpMethodIndex(route->method)] = route;
+        }
+        
+        // Get the route registered for a method index, nullptr if none
+        const HttpRoute* GetRoute(Size methodIndex) const {
+            return routes[methodIndex];
+        }
+        
         // Get endpoint pattern
-        StdString GetEndpointPattern() const {
+        const StdString& GetEndpointPattern() const {
             return endpointPattern;
         }
         
@@ -203,96 +227,47 @@ class EndpointTrie {
         }
         
         /**
-         * Recursive search helper
+         * Convert an allocation-free match into the string/map based result
          */
-        EndpointMatchResult SearchRecursive(
-            EndpointTrieNode* node,
-            const StdVector<StdString>& segments,
-            size_t index,
-            StdMap<StdString, StdString>& variables
-        ) const {
-            // If we've processed all segments
-            if (index >= segments.size()) {
-                if (node->IsEndpoint()) {
-                    return EndpointMatchResult(node->GetEndpointPattern(), variables);
-                }
-                return EndpointMatchResult();  // No match
+        static EndpointMatchResult ToResult(const EndpointMatch& match, std::string_view path) {
+            if (!match.found) {
+                EndpointMatchResult result;
+                result.methodMismatch = match.methodMismatch;
+                return result;
             }
+            EndpointMatchResult result(StdString(match.pattern), match.ToVariables(path));
+            result.route = match.route;
+            return result;
+        }
+
+    Public
+        /**
+         * Node access for EndpointMatcher over the pointer-based nodes
+         */
+        struct Layout {
+            using NodeRef = const EndpointTrieNode*;
             
-            StdString currentSegment = segments[index];
-            
-            // Special handling for empty segment (trailing slash)
-            // If we encounter an empty segment, prefer exact endpoint match over variable match
-            // This handles the case where /xyz/ should match /xyz instead of /xyz/{ssid}
-            if (currentSegment.empty()) {
-                // If we're at the last segment (trailing slash at end of path)
-                if (index + 1 >= segments.size()) {
-                    // Only match if current node is an endpoint AND we haven't consumed any variables
-                    // This ensures:
-                    // - /xyz/ matches /xyz (exact literal match, no variables consumed)
-                    // - /api/user/123/ does NOT match /api/user/{userId} (variable was consumed)
-                    if (node->IsEndpoint() && variables.empty()) {
-                        return EndpointMatchResult(node->GetEndpointPattern(), variables);
-                    }
-                    // If we consumed variables or node is not an endpoint, no match
-                    // This ensures paths with trailing slash don't match patterns without trailing slash
-                    // when variables were consumed
-                    return EndpointMatchResult();  // No match - trailing slash doesn't match pattern
-                }
-                // If there are more segments after the empty one, try variable match
-                // (This handles cases like /api/{var}//something, though uncommon)
-                const StdMap<StdString, EndpointTrieNode*>& varChildren = node->GetVariableChildren();
-                for (const auto& pair : varChildren) {
-                    StdString varName = pair.first;
-                    EndpointTrieNode* varChild = pair.second;
-                    
-                    // Store the variable value (empty string for trailing slash)
-                    variables[varName] = currentSegment;
-                    
-                    // Continue search with next segment
-                    EndpointMatchResult result = SearchRecursive(varChild, segments, index + 1, variables);
-                    if (result.found) {
-                        return result;
-                    }
-                    
-                    // Backtrack: remove the variable we just tried
-                    variables.erase(varName);
-                }
-                return EndpointMatchResult();  // No match
-            }
+            const EndpointTrieNode* root;
             
-            // For non-empty segments, try literal match first
-            EndpointTrieNode* literalChild = node->GetLiteralChild(currentSegment);
-            if (literalChild != nullptr) {
-                EndpointMatchResult result = SearchRecursive(literalChild, segments, index + 1, variables);
-                if (result.found) {
-                    return result;
-                }
-            }
+            NodeRef Root() const { return root; }
+            Bool IsNull(NodeRef node) const { return node == nullptr; }
+            NodeRef FindLiteral(NodeRef node, std::string_view segment) const { return node->GetLiteralChild(segment); }
+            Bool HasVariables(NodeRef node) const { return !node->GetVariableChildren().empty(); }
+            Bool IsEndpoint(NodeRef node) const { return node->IsEndpoint(); }
+            const HttpRoute* GetRoute(NodeRef node, Size methodIndex) const { return node->GetRoute(methodIndex); }
+            std::string_view GetPattern(NodeRef node) const { return node->GetEndpointPattern(); }
             
-            // Try variable match (try all variable children)
-            const StdMap<StdString, EndpointTrieNode*>& varChildren = node->GetVariableChildren();
-            for (const auto& pair : varChildren) {
-                StdString varName = pair.first;
-                EndpointTrieNode* varChild = pair.second;
-                
-                // Store the variable value
-                variables[varName] = currentSegment;
-                
-                // Continue search
-                EndpointMatchResult result = SearchRecursive(varChild, segments, index + 1, variables);
-                if (result.found) {
-                    return result;
+            template<typename F>
+            Bool ForEachVariable(NodeRef node, F&& f) const {
+                for (const auto& pair : node->GetVariableChildren()) {
+                    if (f(std::string_view(pair.first), pair.second)) {
+                        return true;
+                    }
                 }
-                
-                // Backtrack: remove the variable we just tried
-                variables.erase(varName);
+                return false;
             }
-            
-            return EndpointMatchResult();  // No match
-        }
-
-    Public
+        };
+        
         EndpointTrie() {
             root = new EndpointTrieNode();
         }
@@ -323,6 +298,29 @@ class EndpointTrie {
             current->SetEndpointPattern(pattern);
         }
         
+        /**
+         * Insert a route: its pattern plus the handler for its method at the endpoint node.
+         * The route must outlive the trie (generated routes live in a static table).
+         * 
+         * @param route The route to register
+         */
+        Void Insert(const HttpRoute& route) {
+            StdString pattern(route.pattern);
+            StdVector<StdString> segments = SplitPath(pattern);
+            EndpointTrieNode* current = root;
+            
+            for (const StdString& segment : segments) {
+                if (IsVariableSegment(segment)) {
+                    current = current->GetOrCreateVariableChild(ExtractVariableName(segment));
+                } else {
+                    current = current->GetOrCreateLiteralChild(segment);
+                }
+            }
+            
+            current->SetEndpointPattern(pattern);
+            current->SetRoute(&route);
+        }
+        
         /**
          * Search for a matching endpoint pattern
          * 
@@ -330,9 +328,41 @@ class EndpointTrie {
          * @return EndpointMatchResult containing the matched pattern and variable values
          */
         EndpointMatchResult Search(const StdString& path) const {
-            StdVector<StdString> segments = SplitPath(path);
-            StdMap<StdString, StdString> variables;
-            return SearchRecursive(root, segments, 0, variables);
+            return ToResult(EndpointMatcher<Layout>::Match(Layout{root}, path, EndpointAnyMethod), path);
+        }
+        
+        /**
+         * Search for the route of a method matching the path
+         * 
+         * Patterns that match the path but have no route for the method are skipped, so
+         * GET /api/user/list can fall back from a POST-only literal to a GET {variable} route.
+         * 
+         * @param path The actual path to match (e.g., "/api/user/123/get")
+         * @param method The request method
+         * @return EndpointMatchResult with route set when found; methodMismatch set when only
+         *         other methods matched
+         */
+        EndpointMatchResult Search(const StdString& path, HttpMethod method) const {
+            return ToResult(EndpointMatcher<Layout>::Match(Layout{root}, path, HttpMethodIndex(method)), path);
+        }
+        
+        /**
+         * Allocation-free variant of Search(path, method) used on the request path.
+         * Variables are returned as slices of path, which must outlive the result.
+         * 
+         * @param path The actual path to match
+         * @param method The request method
+         * @return EndpointMatch with route and captures when found
+         */
+        EndpointMatch Match(std::string_view path, HttpMethod method) const {
+            return EndpointMatcher<Layout>::Match(Layout{root}, path, HttpMethodIndex(method));
+        }
+        
+        /**
+         * Root node, for compiling the trie into a CompiledEndpointTrie
+         */
+        const EndpointTrieNode* GetRoot() const {
+            return root;
         }
         
         /**
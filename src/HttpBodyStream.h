@@ -0,0 +1,55 @@
+#ifndef HTTP_BODY_STREAM_H
+#define HTTP_BODY_STREAM_H
+
+#include "IHttpBodyStream.h"
+#include <cstring>
+
+/**
+ * Body stream over a request body held by the server
+ *
+ * Handlers taking an IHttpBodyStream& parameter get one of these: the body is consumed
+ * chunk by chunk straight from the server's buffer, so a large upload is never duplicated
+ * into a String parameter or a deserialized DTO. The stream only lives for the duration
+ * of the handler call.
+ */
+class HttpBodyStream final : public IHttpBodyStream {
+    Private std::string_view body;
+    Private Size position;
+
+    Public explicit HttpBodyStream(std::string_view body)
+        : body(body), position(0) {
+    }
+
+    HttpBodyStream(const HttpBodyStream&) = delete;
+    HttpBodyStream& operator=(const HttpBodyStream&) = delete;
+
+    Public ~HttpBodyStream() override = default;
+
+    Public Size Read(Char* buffer, CSize capacity) override {
+        std::string_view chunk = ReadChunk(capacity);
+        if (!chunk.empty()) {
+            std::memcpy(buffer, chunk.data(), chunk.length());
+        }
+        return chunk.length();
+    }
+
+    Public std::string_view ReadChunk(CSize maxBytes) override {
+        std::string_view chunk = body.substr(position, maxBytes);
+        position += chunk.length();
+        return chunk;
+    }
+
+    Public Size GetContentLength() const override {
+        return body.length();
+    }
+
+    Public Size GetBytesRead() const override {
+        return position;
+    }
+
+    Public Bool IsComplete() const override {
+        return position == body.length();
+    }
+};
+
+#endif // HTTP_BODY_STREAM_H
@@ -0,0 +1,99 @@
+#ifndef HTTP_CLOUD_RESPONSE_PROCESSOR_H
+#define HTTP_CLOUD_RESPONSE_PROCESSOR_H
+
+#include "IHttpCloudResponseProcessor.h"
+#include "IHttpResponseQueue.h"
+#include <ServerProvider.h>
+#include <IHttpResponse.h>
+#include "HttpResponseWriter.h"
+#include "IHttpMetrics.h"
+
+/* @Component */
+class HttpCloudResponseProcessor final : public IHttpCloudResponseProcessor {
+
+    /* @Autowired */
+    Private IHttpResponseQueuePtr responseQueue;
+
+#if HTTP_METRICS_ENABLED
+    /* @Autowired */
+    Private IHttpMetricsPtr metrics;
+#endif
+
+    // Cloud requests arrive on the default (primary) server, so replies go back through it
+    Private IServerPtr server;
+
+    // Reused between calls so steady-state batching does not allocate; the processor
+    // is driven by the request loop thread only
+    Private StdVector<IHttpResponsePtr> batch;
+
+    // Renders each response into one reused buffer (HTTP_RESPONSE_DIRECT_WRITE)
+    Private HttpResponseWriter writer;
+
+    Public HttpCloudResponseProcessor()
+        : server(ServerProvider::GetDefaultServer()) {
+    }
+
+    Public ~HttpCloudResponseProcessor() override = default;
+
+    // ============================================================================
+    // HTTP Cloud Response Processing Operations
+    // ============================================================================
+
+    Public Size ProcessResponses(CSize maxCount) override {
+        batch.clear();
+        Size taken = responseQueue->DequeueCloudResponses(batch, maxCount);
+
+        for (IHttpResponsePtr& response : batch) {
+            SendResponse(response);
+        }
+
+        // Drop references now instead of holding them until the next batch
+        batch.clear();
+        return taken;
+    }
+
+    Private Void SendResponse(const IHttpResponsePtr& response) {
+        if (server == nullptr || response == nullptr) {
+            return;
+        }
+
+        StdString requestId = StdString(response->GetRequestId());
+        if (requestId.empty() || requestId == "ignore") {
+            return;
+        }
+
+#if HTTP_METRICS_ENABLED
+        const UInt64 startNs = HttpMetricsNow();
+#endif
+#if HTTP_RESPONSE_DIRECT_WRITE
+        CStdString& responseString = writer.Write(*response);
+#else
+        StdString responseString = response->ToHttpString();
+        if (responseString.empty()) {
+            return;
+        }
+#endif
+
+#if HTTP_METRICS_ENABLED
+        const UInt64 renderedNs = HttpMetricsNow();
+#endif
+        server->SendMessage(requestId, responseString);
+#if HTTP_METRICS_ENABLED
+        RecordStages(startNs, renderedNs);
+#endif
+#if HTTP_RESPONSE_DIRECT_WRITE
+        writer.Reset();
+#endif
+    }
+
+#if HTTP_METRICS_ENABLED
+    Private Void RecordStages(UInt64 startNs, UInt64 renderedNs) {
+        if (metrics != nullptr) {
+            metrics->RecordStage(HttpPipelineStage::Serialization, renderedNs - startNs);
+            metrics->RecordStage(HttpPipelineStage::Send, HttpMetricsNow() - renderedNs);
+        }
+    }
+#endif
+};
+
+#endif // HTTP_CLOUD_RESPONSE_PROCESSOR_H
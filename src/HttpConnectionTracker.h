@@ -0,0 +1,190 @@
+#ifndef HTTP_CONNECTION_TRACKER_H
+#define HTTP_CONNECTION_TRACKER_H
+
+#include "IHttpConnectionTracker.h"
+#include "IHttpPipelineConfig.h"
+#include "HttpPipelineDefaults.h"
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+
+/**
+ * Keep-alive bookkeeping per connection (requestId)
+ *
+ * Requests are counted as they are admitted and responses as they are sent, so several
+ * pipelined requests can be in flight on one connection (their responses keep request
+ * order through HttpResponseReorderBuffer). Each response carries the decision:
+ *   - Connection: keep-alive + Keep-Alive: timeout=<s>, max=<remaining>, or
+ *   - Connection: close when the client asked for it, the connection reached
+ *     GetKeepAliveMaxRequests(), all HTTP_KEEP_ALIVE_MAX_CONNECTIONS slots are taken, or
+ *     keep-alive is disabled.
+ * Idle connections are forgotten after GetKeepAliveTimeoutMs(), freeing their slot; closing
+ * the socket itself is left to the server, which sees the advertised timeout.
+ */
+/* @Component */
+class HttpConnectionTracker final : public IHttpConnectionTracker {
+    using Clock = std::chrono::steady_clock;
+
+    struct Connection {
+        UInt pending = 0;        // Admitted, response not sent yet
+        UInt served = 0;         // Responses sent
+        Bool keepAlive = true;   // false once the connection is going to close
+        Clock::time_point lastActivity;
+    };
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
+    Private std::mutex trackerMutex;
+    Private StdMap<StdString, Connection> connections;
+    Private Size keepAliveCount;  // Tracked connections holding a keep-alive slot
+
+    Public HttpConnectionTracker() : keepAliveCount(0) {
+    }
+
+    Public ~HttpConnectionTracker() override = default;
+
+    // ============================================================================
+    // Connection Tracking Operations (thread-safe)
+    // ============================================================================
+
+    Public Void OnRequest(CStdString& requestId, CStdString& connectionHeader) override {
+        if (requestId.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(trackerMutex);
+        auto it = connections.find(requestId);
+        if (it == connections.end()) {
+            it = connections.emplace(requestId, Connection()).first;
+            if (GetMaxRequests() == 0 || keepAliveCount >= HTTP_KEEP_ALIVE_MAX_CONNECTIONS) {
+                it->second.keepAlive = false;
+            } else {
+                keepAliveCount++;
+            }
+        }
+        Connection& connection = it->second;
+        connection.pending++;
+        connection.lastActivity = Clock::now();
+        if (connection.keepAlive && HasCloseToken(connectionHeader)) {
+            Close(connection);
+        }
+    }
+
+    Public StdString OnResponse(CStdString& requestId) override {
+        static constexpr CChar* closeHeaders = "Connection: close\r\n";
+
+        std::lock_guard<std::mutex> lock(trackerMutex);
+        auto it = connections.find(requestId);
+        if (it == connections.end()) {
+            return StdString();
+        }
+        Connection& connection = it->second;
+        connection.served++;
+        if (connection.pending > 0) {
+            connection.pending--;
+        }
+        connection.lastActivity = Clock::now();
+
+        CUInt maxRequests = GetMaxRequests();
+        if (connection.keepAlive && connection.served >= maxRequests) {
+            Close(connection);
+        }
+        if (!connection.keepAlive) {
+            // Nothing is sent on this connection after the close
+            if (connection.pending == 0) {
+                connections.erase(it);
+            }
+            return closeHeaders;
+        }
+
+        // Formatted on the stack: several senders may call in, so nothing is shared
+        // once the lock is released
+        CUInt timeoutSeconds = (config != nullptr ? config->GetKeepAliveTimeoutMs() : HTTP_KEEP_ALIVE_TIMEOUT_MS) / 1000;
+        Char headers[96];
+        Int length = snprintf(headers, sizeof(headers),
+                              "Connection: keep-alive\r\nKeep-Alive: timeout=%u, max=%u\r\n",
+                              timeoutSeconds == 0 ? 1u : timeoutSeconds, maxRequests - connection.served);
+        return StdString(headers, static_cast<Size>(length));
+    }
+
+    Public Size ExpireIdleConnections() override {
+        CUInt timeoutMs = config != nullptr ? config->GetKeepAliveTimeoutMs() : HTTP_KEEP_ALIVE_TIMEOUT_MS;
+        Clock::time_point deadline = Clock::now() - std::chrono::milliseconds(timeoutMs);
+
+        std::lock_guard<std::mutex> lock(trackerMutex);
+        Size expired = 0;
+        for (auto it = connections.begin(); it != connections.end();) {
+            // Requests still pending this long were dropped or stalled (DropOldest discards
+            // requests without a response); their late response goes out without the headers
+            if (it->second.lastActivity <= deadline) {
+                Close(it->second);
+                it = connections.erase(it);
+                expired++;
+            } else {
+                ++it;
+            }
+        }
+        return expired;
+    }
+
+    Public Size GetConnectionCount() override {
+        std::lock_guard<std::mutex> lock(trackerMutex);
+        return connections.size();
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    Private UInt GetMaxRequests() const {
+        return config != nullptr ? config->GetKeepAliveMaxRequests() : HTTP_KEEP_ALIVE_MAX_REQUESTS;
+    }
+
+    /**
+     * Stop keeping a connection alive and give back its slot. Caller holds trackerMutex.
+     */
+    Private Void Close(Connection& connection) {
+        if (connection.keepAlive) {
+            connection.keepAlive = false;
+            keepAliveCount--;
+        }
+    }
+
+    /**
+     * Connection is a comma-separated, case-insensitive token list, e.g. "close" or
+     * "keep-alive, Upgrade"
+     */
+    Private Static Bool HasCloseToken(CStdString& header) {
+        static constexpr std::string_view close = "close";
+        Size begin = 0;
+        while (begin < header.length()) {
+            Size end = header.find(',', begin);
+            if (end == StdString::npos) {
+                end = header.length();
+            }
+            Size first = header.find_first_not_of(" \t", begin);
+            Size last = header.find_last_not_of(" \t", end - 1);
+            if (first != StdString::npos && first < end && last >= first && last + 1 - first == close.length()) {
+                Bool matches = true;
+                for (Size i = 0; i < close.length(); i++) {
+                    Char c = header[first + i];
+                    if (c >= 'A' && c <= 'Z') {
+                        c = static_cast<Char>(c - 'A' + 'a');
+                    }
+                    if (c != close[i]) {
+                        matches = false;
+                        break;
+                    }
+                }
+                if (matches) {
+                    return true;
+                }
+            }
+            begin = end + 1;
+        }
+        return false;
+    }
+};
+
+#endif // HTTP_CONNECTION_TRACKER_H
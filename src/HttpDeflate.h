@@ -0,0 +1,300 @@
+#ifndef HTTP_DEFLATE_H
+#define HTTP_DEFLATE_H
+
+#include <StandardDefines.h>
+#include "HttpPipelineDefaults.h"
+#include <string_view>
+#include <algorithm>
+
+/**
+ * Content codings the framework can produce (Content-Encoding values)
+ */
+enum class HttpContentEncoding {
+    Identity,
+    Gzip,     // RFC 1952 gzip member
+    Deflate   // RFC 1950 zlib stream, as HTTP's "deflate" coding requires
+};
+
+inline CChar* ContentEncodingName(HttpContentEncoding encoding) {
+    switch (encoding) {
+        case HttpContentEncoding::Gzip: return "gzip";
+        case HttpContentEncoding::Deflate: return "deflate";
+        case HttpContentEncoding::Identity: break;
+    }
+    return "identity";
+}
+
+/**
+ * Small DEFLATE (RFC 1951) encoder for response bodies: greedy LZ77 over a
+ * HTTP_COMPRESSION_WINDOW_BYTES window, one block with the fixed Huffman codes.
+ *
+ * Tuned for repetitive JSON on small devices rather than ratio: no dynamic trees, bounded
+ * match search, and about 4 * (HTTP_COMPRESSION_WINDOW_BYTES + 2048) bytes of match state
+ * allocated once per encoder and reused. Not thread-safe.
+ */
+class HttpDeflate {
+    static_assert((HTTP_COMPRESSION_WINDOW_BYTES & (HTTP_COMPRESSION_WINDOW_BYTES - 1)) == 0 &&
+                  HTTP_COMPRESSION_WINDOW_BYTES >= 256 && HTTP_COMPRESSION_WINDOW_BYTES <= 32768,
+                  "HTTP_COMPRESSION_WINDOW_BYTES must be a power of two between 256 and 32768");
+
+    Private Static constexpr Size HashSize = 2048;
+    Private Static constexpr Size WindowMask = HTTP_COMPRESSION_WINDOW_BYTES - 1;
+    Private Static constexpr UInt MaxChain = 32;   // Candidates examined per position
+    Private Static constexpr Size MinMatch = 3;
+    Private Static constexpr Size MaxMatch = 258;
+
+    // Position + 1 of the latest / previous occurrence of a 3-byte sequence (0 = none)
+    Private StdVector<UInt32> head;
+    Private StdVector<UInt32> previous;
+
+    Private StdString* output;
+    Private UInt32 bitBuffer;
+    Private UInt bitCount;
+
+    Public HttpDeflate() : output(nullptr), bitBuffer(0), bitCount(0) {
+    }
+
+    /**
+     * @brief Compress a body into the given content coding
+     * @param input Uncompressed bytes
+     * @param encoding Gzip or Deflate (Identity copies the input)
+     * @param compressed Receives the encoded bytes (replaced)
+     */
+    Public Void Compress(std::string_view input, HttpContentEncoding encoding, StdString& compressed) {
+        compressed.clear();
+        if (encoding == HttpContentEncoding::Identity) {
+            compressed.assign(input.data(), input.length());
+            return;
+        }
+        // Repetitive JSON typically shrinks to well under half; otherwise the string grows
+        compressed.reserve(input.length() / 2 + 32);
+        output = &compressed;
+        bitBuffer = 0;
+        bitCount = 0;
+
+        if (encoding == HttpContentEncoding::Gzip) {
+            static constexpr UInt8 gzipHeader[10] = {0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF};
+            compressed.append(reinterpret_cast<CChar*>(gzipHeader), sizeof(gzipHeader));
+        } else {
+            compressed.push_back(static_cast<Char>(0x78));  // 32K window, deflate
+            compressed.push_back(static_cast<Char>(0x01));  // Fastest level, header check bits
+        }
+
+        EncodeBlock(input);
+
+        if (encoding == HttpContentEncoding::Gzip) {
+            AppendLittleEndian(Crc32(input));
+            AppendLittleEndian(static_cast<UInt32>(input.length()));
+        } else {
+            AppendBigEndian(Adler32(input));
+        }
+        output = nullptr;
+    }
+
+    // ============================================================================
+    // Checksums
+    // ============================================================================
+
+    Public Static UInt32 Crc32(std::string_view data) {
+        static constexpr auto table = []() {
+            struct { UInt32 values[256]; } result{};
+            for (UInt32 i = 0; i < 256; i++) {
+                UInt32 crc = i;
+                for (Int bit = 0; bit < 8; bit++) {
+                    crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+                }
+                result.values[i] = crc;
+            }
+            return result;
+        }();
+        UInt32 crc = 0xFFFFFFFFu;
+        for (Char c : data) {
+            crc = table.values[(crc ^ static_cast<UInt8>(c)) & 0xFF] ^ (crc >> 8);
+        }
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    Public Static UInt32 Adler32(std::string_view data) {
+        UInt32 a = 1;
+        UInt32 b = 0;
+        Size index = 0;
+        while (index < data.length()) {
+            // 5552 bytes keep b below 2^32 before the modulo
+            Size end = std::min(data.length(), index + 5552);
+            for (; index < end; index++) {
+                a += static_cast<UInt8>(data[index]);
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        return (b << 16) | a;
+    }
+
+    // ============================================================================
+    // Encoder
+    // ============================================================================
+
+    Private Static UInt32 Hash(std::string_view input, CSize position) {
+        UInt32 value = (static_cast<UInt32>(static_cast<UInt8>(input[position])) << 10) ^
+                       (static_cast<UInt32>(static_cast<UInt8>(input[position + 1])) << 5) ^
+                       static_cast<UInt32>(static_cast<UInt8>(input[position + 2]));
+        return ((value * 2654435761u) >> 21) & (HashSize - 1);
+    }
+
+    Private Void Insert(std::string_view input, CSize position) {
+        if (position + MinMatch > input.length()) {
+            return;
+        }
+        UInt32 hash = Hash(input, position);
+        previous[position & WindowMask] = head[hash];
+        head[hash] = static_cast<UInt32>(position + 1);
+    }
+
+    Private Void EncodeBlock(std::string_view input) {
+        if (head.empty()) {
+            head.resize(HashSize);
+            previous.resize(HTTP_COMPRESSION_WINDOW_BYTES);
+        }
+        std::fill(head.begin(), head.end(), 0u);
+
+        WriteBits(1, 1);  // BFINAL
+        WriteBits(1, 2);  // BTYPE = 01, fixed Huffman codes
+
+        Size position = 0;
+        while (position < input.length()) {
+            Size bestLength = 0;
+            Size bestDistance = 0;
+            if (position + MinMatch <= input.length()) {
+                CSize maxLength = std::min(MaxMatch, input.length() - position);
+                UInt32 candidate = head[Hash(input, position)];
+                UInt chain = MaxChain;
+                while (candidate != 0 && chain-- > 0) {
+                    CSize candidatePosition = candidate - 1;
+                    CSize distance = position - candidatePosition;
+                    if (distance > HTTP_COMPRESSION_WINDOW_BYTES) {
+                        break;
+                    }
+                    if (input[candidatePosition + bestLength] == input[position + bestLength]) {
+                        Size length = 0;
+                        while (length < maxLength && input[candidatePosition + length] == input[position + length]) {
+                            length++;
+                        }
+                        if (length > bestLength) {
+                            bestLength = length;
+                            bestDistance = distance;
+                            if (length == maxLength) {
+                                break;
+                            }
+                        }
+                    }
+                    UInt32 next = previous[candidatePosition & WindowMask];
+                    if (next >= candidate) {
+                        break;  // Slot reused by a newer position: chain is over
+                    }
+                    candidate = next;
+                }
+            }
+
+            if (bestLength >= MinMatch) {
+                WriteLengthDistance(bestLength, bestDistance);
+                for (Size i = 0; i < bestLength; i++) {
+                    Insert(input, position + i);
+                }
+                position += bestLength;
+            } else {
+                WriteLiteral(static_cast<UInt8>(input[position]));
+                Insert(input, position);
+                position++;
+            }
+        }
+
+        WriteSymbol(256);  // End of block
+        if (bitCount > 0) {
+            output->push_back(static_cast<Char>(bitBuffer & 0xFF));
+            bitBuffer = 0;
+            bitCount = 0;
+        }
+    }
+
+    Private Void WriteLengthDistance(CSize length, CSize distance) {
+        static constexpr UInt16 lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static constexpr UInt8 lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static constexpr UInt16 distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                    8193, 12289, 16385, 24577};
+        static constexpr UInt8 distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                                    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        Size lengthCode = 28;
+        while (lengthBase[lengthCode] > length) {
+            lengthCode--;
+        }
+        WriteSymbol(static_cast<UInt>(257 + lengthCode));
+        WriteBits(static_cast<UInt32>(length - lengthBase[lengthCode]), lengthExtra[lengthCode]);
+
+        Size distanceCode = 29;
+        while (distanceBase[distanceCode] > distance) {
+            distanceCode--;
+        }
+        WriteHuffman(static_cast<UInt32>(distanceCode), 5);  // Fixed distance codes are 5 bits
+        WriteBits(static_cast<UInt32>(distance - distanceBase[distanceCode]), distanceExtra[distanceCode]);
+    }
+
+    Private Void WriteLiteral(UInt8 value) {
+        WriteSymbol(value);
+    }
+
+    /**
+     * Literal/length symbol with the fixed code of RFC 1951 section 3.2.6
+     */
+    Private Void WriteSymbol(CUInt symbol) {
+        if (symbol < 144) {
+            WriteHuffman(0x30 + symbol, 8);
+        } else if (symbol < 256) {
+            WriteHuffman(0x190 + (symbol - 144), 9);
+        } else if (symbol < 280) {
+            WriteHuffman(symbol - 256, 7);
+        } else {
+            WriteHuffman(0xC0 + (symbol - 280), 8);
+        }
+    }
+
+    /**
+     * Huffman codes are stored most significant bit first
+     */
+    Private Void WriteHuffman(UInt32 code, CUInt length) {
+        UInt32 reversed = 0;
+        for (UInt i = 0; i < length; i++) {
+            reversed = (reversed << 1) | (code & 1);
+            code >>= 1;
+        }
+        WriteBits(reversed, length);
+    }
+
+    Private Void WriteBits(UInt32 value, CUInt count) {
+        bitBuffer |= value << bitCount;
+        bitCount += count;
+        while (bitCount >= 8) {
+            output->push_back(static_cast<Char>(bitBuffer & 0xFF));
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
+    }
+
+    Private Void AppendLittleEndian(UInt32 value) {
+        for (Int shift = 0; shift < 32; shift += 8) {
+            output->push_back(static_cast<Char>((value >> shift) & 0xFF));
+        }
+    }
+
+    Private Void AppendBigEndian(UInt32 value) {
+        for (Int shift = 24; shift >= 0; shift -= 8) {
+            output->push_back(static_cast<Char>((value >> shift) & 0xFF));
+        }
+    }
+};
+
+#endif // HTTP_DEFLATE_H
@@ -0,0 +1,163 @@
+#ifndef HTTP_ERROR_RESPONSE_H
+#define HTTP_ERROR_RESPONSE_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+#include <SimpleHttpResponse.h>
+#include "HttpResponsePool.h"
+#include "HttpStatus.h"
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+/**
+ * JSON error body with "{}" placeholders, e.g.
+ *   {"error":"Not Found","message":"No pattern matched for URL: {}"}
+ * Placeholders are filled in order with JSON-escaped arguments.
+ */
+struct HttpErrorTemplate {
+    HttpStatus status;
+    std::string_view body;
+};
+
+/**
+ * Error bodies produced by the framework itself
+ */
+namespace HttpErrorTemplates {
+    inline constexpr HttpErrorTemplate NotFound{HttpStatus::NOT_FOUND,
+        R"({"error":"Not Found","message":"No pattern matched for URL: {}"})"};
+    inline constexpr HttpErrorTemplate MethodNotAllowed{HttpStatus::METHOD_NOT_ALLOWED,
+        R"({"error":"Method Not Allowed","message":"Method not supported for URL: {}"})"};
+    inline constexpr HttpErrorTemplate InvalidPathVariable{HttpStatus::BAD_REQUEST,
+        R"({"error":"Bad Request","message":"Invalid value for path variable '{}': {}"})"};
+    inline constexpr HttpErrorTemplate MissingRequestParam{HttpStatus::BAD_REQUEST,
+        R"({"error":"Bad Request","message":"Missing required query parameter '{}'"})"};
+    inline constexpr HttpErrorTemplate InvalidRequestParam{HttpStatus::BAD_REQUEST,
+        R"({"error":"Bad Request","message":"Invalid value for query parameter '{}': {}"})"};
+    inline constexpr HttpErrorTemplate InternalServerError{HttpStatus::INTERNAL_SERVER_ERROR,
+        R"({"error":"Internal Server Error","message":"{}"})"};
+    inline constexpr HttpErrorTemplate ServiceUnavailable{HttpStatus::SERVICE_UNAVAILABLE,
+        R"({"error":"Service Unavailable","message":"Request queue is full"})"};
+
+    // Any status: reason phrase and message are both arguments
+    inline constexpr HttpErrorTemplate Generic{HttpStatus::INTERNAL_SERVER_ERROR,
+        R"({"error":"{}","message":"{}"})"};
+}
+
+/**
+ * Builds error responses from HttpErrorTemplate bodies
+ *
+ * The body size (template + escaped arguments) is computed first and the body is written
+ * into a single allocation; the response is created with its request id already set. No
+ * ResponseEntity round trip, no exceptions.
+ */
+class HttpErrorResponse {
+    Private Static CChar* HexDigits() {
+        return "0123456789abcdef";
+    }
+
+    /**
+     * Length of a value once JSON-escaped
+     */
+    Private Static Size EscapedLength(std::string_view value) {
+        Size length = value.length();
+        for (Char c : value) {
+            UInt8 byte = static_cast<UInt8>(c);
+            if (c == '"' || c == '\\' || c == '\n' || c == '\r' || c == '\t' || c == '\b' || c == '\f') {
+                length += 1;
+            } else if (byte < 0x20) {
+                length += 5;  // \u00XX
+            }
+        }
+        return length;
+    }
+
+    Public
+        /**
+         * @brief Append a value to a JSON string literal being built (quotes, backslashes and
+         *        control characters escaped)
+         */
+        Static Void AppendJsonEscaped(StdString& out, std::string_view value) {
+            for (Char c : value) {
+                UInt8 byte = static_cast<UInt8>(c);
+                switch (c) {
+                    case '"': out.append("\\\"", 2); break;
+                    case '\\': out.append("\\\\", 2); break;
+                    case '\n': out.append("\\n", 2); break;
+                    case '\r': out.append("\\r", 2); break;
+                    case '\t': out.append("\\t", 2); break;
+                    case '\b': out.append("\\b", 2); break;
+                    case '\f': out.append("\\f", 2); break;
+                    default:
+                        if (byte < 0x20) {
+                            out.append("\\u00", 4);
+                            out.push_back(HexDigits()[byte >> 4]);
+                            out.push_back(HexDigits()[byte & 0x0F]);
+                        } else {
+                            out.push_back(c);
+                        }
+                        break;
+                }
+            }
+        }
+
+        /**
+         * @brief Render a template body
+         * @param errorTemplate Body with "{}" placeholders
+         * @param arguments Values for the placeholders, in order; missing ones render empty
+         * @return The JSON body, allocated once
+         */
+        Static StdString RenderBody(const HttpErrorTemplate& errorTemplate, std::initializer_list<std::string_view> arguments = {}) {
+            std::string_view body = errorTemplate.body;
+
+            Size total = body.length();
+            for (std::string_view argument : arguments) {
+                total += EscapedLength(argument);
+            }
+
+            StdString rendered;
+            rendered.reserve(total);
+            const std::string_view* argument = arguments.begin();
+            Size start = 0;
+            for (Size placeholder = body.find("{}"); placeholder != std::string_view::npos; placeholder = body.find("{}", start)) {
+                rendered.append(body.data() + start, placeholder - start);
+                if (argument != arguments.end()) {
+                    AppendJsonEscaped(rendered, *argument++);
+                }
+                start = placeholder + 2;
+            }
+            rendered.append(body.data() + start, body.length() - start);
+            return rendered;
+        }
+
+        /**
+         * @brief Create an error response from a template
+         * @param errorTemplate Status and body template
+         * @param requestId Connection id for the response (may be empty)
+         * @param arguments Values for the body placeholders
+         * @return Response with the template's status and the rendered JSON body
+         */
+        Static IHttpResponsePtr Create(const HttpErrorTemplate& errorTemplate, CStdString& requestId,
+                                       std::initializer_list<std::string_view> arguments = {}) {
+            return MakeResponse(errorTemplate.status, requestId, RenderBody(errorTemplate, arguments));
+        }
+
+        /**
+         * @brief Create an error response for any status: {"error":"<reason phrase>","message":"<message>"}
+         * @param status Error status
+         * @param requestId Connection id for the response (may be empty)
+         * @param message Error message (JSON-escaped into the body)
+         */
+        Static IHttpResponsePtr Create(HttpStatus status, CStdString& requestId, std::string_view message) {
+            return MakeResponse(status, requestId, RenderBody(HttpErrorTemplates::Generic, {GetStatusText(status), message}));
+        }
+
+    Private
+        Static IHttpResponsePtr MakeResponse(HttpStatus status, CStdString& requestId, StdString&& body) {
+            static const StdMap<StdString, StdString> noHeaders;
+            return MakeHttpResponse(requestId, RequestSource::LocalServer, StatusToInt(status),
+                                    GetStatusMessage(status), noHeaders, std::move(body));
+        }
+};
+
+#endif // HTTP_ERROR_RESPONSE_H
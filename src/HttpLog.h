@@ -0,0 +1,100 @@
+#ifndef HTTP_LOG_H
+#define HTTP_LOG_H
+
+#include "IHttpLog.h"
+#include "MpmcRingBuffer.h"
+#include "HttpPipelineDefaults.h"
+#include <ILogger.h>
+#include <atomic>
+#include <cstdio>
+
+/**
+ * Logging facade in front of ILogger for the request pipeline
+ *
+ * A record is formatted into a fixed-size buffer (no heap allocation on the logging
+ * thread) and pushed onto a lock-free ring; the request loop forwards buffered records
+ * to ILogger once the pass's responses are sent. With HTTP_LOG_ASYNC=0 records go
+ * straight to ILogger instead.
+ */
+/* @Component */
+class HttpLog final : public IHttpLog {
+    struct Record {
+        HttpLogLevel level;
+        Char message[HTTP_LOG_MESSAGE_BYTES];
+    };
+
+    /* @Autowired */
+    Private ILoggerPtr logger;
+
+#if HTTP_LOG_ASYNC
+    Private MpmcRingBuffer<Record> ring;
+#endif
+    Private std::atomic<Size> dropped;
+
+#if HTTP_LOG_ASYNC
+    Public HttpLog() : ring(HTTP_LOG_RING_ENTRIES), dropped(0) {
+    }
+#else
+    Public HttpLog() : dropped(0) {
+    }
+#endif
+
+    Public ~HttpLog() override = default;
+
+    // ============================================================================
+    // Logging Operations (thread-safe)
+    // ============================================================================
+
+    Public Void Write(HttpLogLevel level, CChar* format, va_list arguments) override {
+        Record record;
+        record.level = level;
+        std::vsnprintf(record.message, sizeof(record.message), format, arguments);
+#if HTTP_LOG_ASYNC
+        if (!ring.TryPush(record)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+#else
+        Forward(record);
+#endif
+    }
+
+    Public Size Drain(CSize maxRecords) override {
+        Size forwarded = 0;
+#if HTTP_LOG_ASYNC
+        Record record;
+        while (forwarded < maxRecords && ring.TryPop(record)) {
+            Forward(record);
+            forwarded++;
+        }
+#endif
+        return forwarded;
+    }
+
+    Public Size GetDroppedCount() const override {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    /**
+     * ILogger::Info is the sink for every level; the level is kept as a message prefix
+     */
+    Private Void Forward(const Record& record) {
+        if (logger == nullptr) {
+            return;
+        }
+        StdString message;
+        switch (record.level) {
+            case HttpLogLevel::Error: message = "[E] "; break;
+            case HttpLogLevel::Warning: message = "[W] "; break;
+            case HttpLogLevel::Info: break;
+            case HttpLogLevel::Debug: message = "[D] "; break;
+        }
+        message += record.message;
+        logger->Info(Tag::Untagged, message);
+    }
+};
+
+#endif // HTTP_LOG_H
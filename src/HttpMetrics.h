@@ -0,0 +1,258 @@
+#include "HttpPipelineDefaults.h"
+
+// Only built with HTTP_METRICS_ENABLED; otherwise the pipeline has no metrics component
+#if !defined(HTTP_METRICS_H) && HTTP_METRICS_ENABLED
+#define HTTP_METRICS_H
+
+#include "IHttpMetrics.h"
+#include "IHttpRequestQueue.h"
+#include "IHttpResponseQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+/**
+ * Lock-free metrics registry of the request pipeline
+ *
+ * Each route gets a fixed slot (claimed with a compare-and-swap on first use, keyed by
+ * the HttpRoute address) holding per-status-class counters and a latency histogram;
+ * recording is a few relaxed atomic increments, so concurrent workers never block each
+ * other. Queue depths are read from the queues when the metrics are rendered.
+ */
+/* @Component */
+class HttpMetrics final : public IHttpMetrics {
+    // Upper bounds of the latency buckets in microseconds; the last bucket is +Inf
+    Private Static constexpr UInt64 BucketBoundsUs[] = {50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000, 250000};
+    Private Static constexpr Size BucketCount = sizeof(BucketBoundsUs) / sizeof(BucketBoundsUs[0]) + 1;
+    Private Static constexpr Size StatusClassCount = 5;  // 1xx..5xx
+
+    struct RouteSlot {
+        std::atomic<const HttpRoute*> route{nullptr};
+        std::atomic<UInt64> statusClasses[StatusClassCount] = {};
+        std::atomic<UInt64> buckets[BucketCount] = {};  // Not cumulative; summed when rendered
+        std::atomic<UInt64> latencySumNs{0};
+    };
+
+    struct StageTotals {
+        std::atomic<UInt64> count{0};
+        std::atomic<UInt64> sumNs{0};
+    };
+
+    /* @Autowired */
+    Private IHttpRequestQueuePtr requestQueue;
+
+    /* @Autowired */
+    Private IHttpResponseQueuePtr responseQueue;
+
+    Private RouteSlot routes[HTTP_METRICS_MAX_ROUTES];
+    Private StageTotals stages[HttpPipelineStageCount];
+    Private std::atomic<UInt64> unmatched;
+    Private std::atomic<UInt64> untracked;  // Requests of routes beyond HTTP_METRICS_MAX_ROUTES
+
+    Public HttpMetrics() : unmatched(0), untracked(0) {
+    }
+
+    Public ~HttpMetrics() override = default;
+
+    // ============================================================================
+    // Recording (lock-free)
+    // ============================================================================
+
+    Public Void RecordRequest(const HttpRoute* route, CUInt statusCode, UInt64 latencyNs) override {
+        RouteSlot* slot = FindSlot(route);
+        if (slot == nullptr) {
+            untracked.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        CUInt statusClass = statusCode / 100;
+        if (statusClass >= 1 && statusClass <= StatusClassCount) {
+            slot->statusClasses[statusClass - 1].fetch_add(1, std::memory_order_relaxed);
+        }
+        slot->buckets[BucketIndex(latencyNs)].fetch_add(1, std::memory_order_relaxed);
+        slot->latencySumNs.fetch_add(latencyNs, std::memory_order_relaxed);
+    }
+
+    Public Void RecordUnmatched() override {
+        unmatched.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Public Void RecordStage(HttpPipelineStage stage, UInt64 elapsedNs) override {
+        StageTotals& totals = stages[static_cast<Size>(stage)];
+        totals.count.fetch_add(1, std::memory_order_relaxed);
+        totals.sumNs.fetch_add(elapsedNs, std::memory_order_relaxed);
+    }
+
+    // ============================================================================
+    // Export
+    // ============================================================================
+
+    Public StdString Render() const override {
+        StdString out;
+        out.reserve(1024);
+
+        out += "# TYPE http_requests_total counter\n";
+        for (const RouteSlot& slot : routes) {
+            const HttpRoute* route = slot.route.load(std::memory_order_acquire);
+            if (route == nullptr) {
+                continue;
+            }
+            for (Size i = 0; i < StatusClassCount; i++) {
+                UInt64 count = slot.statusClasses[i].load(std::memory_order_relaxed);
+                if (count == 0) {
+                    continue;
+                }
+                Char code[8];
+                std::snprintf(code, sizeof(code), "%uxx", static_cast<unsigned>(i + 1));
+                AppendSample(out, "http_requests_total", route, "code", code, count);
+            }
+        }
+        out += "# TYPE http_requests_unmatched_total counter\n";
+        AppendSample(out, "http_requests_unmatched_total", nullptr, nullptr, nullptr, unmatched.load(std::memory_order_relaxed));
+        out += "# TYPE http_requests_untracked_total counter\n";
+        AppendSample(out, "http_requests_untracked_total", nullptr, nullptr, nullptr, untracked.load(std::memory_order_relaxed));
+
+        out += "# TYPE http_request_duration_seconds histogram\n";
+        for (const RouteSlot& slot : routes) {
+            const HttpRoute* route = slot.route.load(std::memory_order_acquire);
+            if (route == nullptr) {
+                continue;
+            }
+            UInt64 cumulative = 0;
+            for (Size i = 0; i < BucketCount; i++) {
+                cumulative += slot.buckets[i].load(std::memory_order_relaxed);
+                Char bound[24];
+                if (i + 1 < BucketCount) {
+                    std::snprintf(bound, sizeof(bound), "%g", static_cast<double>(BucketBoundsUs[i]) / 1e6);
+                } else {
+                    std::snprintf(bound, sizeof(bound), "+Inf");
+                }
+                AppendSample(out, "http_request_duration_seconds_bucket", route, "le", bound, cumulative);
+            }
+            AppendSeconds(out, "http_request_duration_seconds_sum", route, nullptr, nullptr, slot.latencySumNs.load(std::memory_order_relaxed));
+            AppendSample(out, "http_request_duration_seconds_count", route, nullptr, nullptr, cumulative);
+        }
+
+        static constexpr CChar* stageNames[HttpPipelineStageCount] = {"routing", "handler", "serialization", "send"};
+        out += "# TYPE http_stage_seconds_total counter\n";
+        for (Size i = 0; i < HttpPipelineStageCount; i++) {
+            AppendSeconds(out, "http_stage_seconds_total", nullptr, "stage", stageNames[i], stages[i].sumNs.load(std::memory_order_relaxed));
+        }
+        out += "# TYPE http_stage_count_total counter\n";
+        for (Size i = 0; i < HttpPipelineStageCount; i++) {
+            AppendSample(out, "http_stage_count_total", nullptr, "stage", stageNames[i], stages[i].count.load(std::memory_order_relaxed));
+        }
+
+        std::pair<CChar*, HttpQueueStats> queues[3];
+        Size queueCount = 0;
+        if (requestQueue != nullptr) {
+            queues[queueCount++] = {"request", requestQueue->GetStats()};
+        }
+        if (responseQueue != nullptr) {
+            queues[queueCount++] = {"response_local", responseQueue->GetLocalStats()};
+            queues[queueCount++] = {"response_cloud", responseQueue->GetCloudStats()};
+        }
+        static constexpr CChar* queueFamilies[4][2] = {
+            {"http_queue_depth", "gauge"}, {"http_queue_high_water_mark", "gauge"},
+            {"http_queue_dropped_total", "counter"}, {"http_queue_rejected_total", "counter"}};
+        for (Size family = 0; family < 4 && queueCount > 0; family++) {
+            out += "# TYPE ";
+            out += queueFamilies[family][0];
+            out += ' ';
+            out += queueFamilies[family][1];
+            out += '\n';
+            for (Size i = 0; i < queueCount; i++) {
+                const HttpQueueStats& stats = queues[i].second;
+                CSize values[4] = {stats.depth, stats.highWaterMark, stats.dropped, stats.rejected};
+                AppendSample(out, queueFamilies[family][0], nullptr, "queue", queues[i].first, values[family]);
+            }
+        }
+        return out;
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    /**
+     * Slot of a route, claimed on first use; nullptr when all slots belong to other routes
+     */
+    Private RouteSlot* FindSlot(const HttpRoute* route) {
+        if (route == nullptr) {
+            return nullptr;
+        }
+        CSize start = static_cast<Size>((reinterpret_cast<std::uintptr_t>(route) >> 3) * 2654435761u) % HTTP_METRICS_MAX_ROUTES;
+        for (Size probe = 0; probe < HTTP_METRICS_MAX_ROUTES; probe++) {
+            RouteSlot& slot = routes[(start + probe) % HTTP_METRICS_MAX_ROUTES];
+            const HttpRoute* owner = slot.route.load(std::memory_order_acquire);
+            if (owner == nullptr) {
+                // Lost race: the winner may have claimed it for this very route
+                if (slot.route.compare_exchange_strong(owner, route, std::memory_order_acq_rel)) {
+                    return &slot;
+                }
+            }
+            if (owner == route) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    Private Static Size BucketIndex(UInt64 latencyNs) {
+        UInt64 latencyUs = latencyNs / 1000;
+        Size index = 0;
+        while (index + 1 < BucketCount && latencyUs > BucketBoundsUs[index]) {
+            index++;
+        }
+        return index;
+    }
+
+    /**
+     * name{route="...",method="...",key="value"} value
+     */
+    Private Static Void AppendLabels(StdString& out, CChar* name, const HttpRoute* route, CChar* key, CChar* value) {
+        out += name;
+        if (route == nullptr && key == nullptr) {
+            return;
+        }
+        out += '{';
+        if (route != nullptr) {
+            out += "route=\"";
+            for (CChar* c = route->pattern; *c != '\0'; c++) {
+                if (*c == '"' || *c == '\\') {
+                    out += '\\';
+                }
+                out += *c;
+            }
+            out += "\",method=\"";
+            out += HttpMethodName(route->method);
+            out += '"';
+            if (key != nullptr) {
+                out += ',';
+            }
+        }
+        if (key != nullptr) {
+            out += key;
+            out += "=\"";
+            out += value;
+            out += '"';
+        }
+        out += '}';
+    }
+
+    Private Static Void AppendSample(StdString& out, CChar* name, const HttpRoute* route, CChar* key, CChar* value, UInt64 sample) {
+        AppendLabels(out, name, route, key, value);
+        Char number[24];
+        std::snprintf(number, sizeof(number), " %llu\n", static_cast<unsigned long long>(sample));
+        out += number;
+    }
+
+    Private Static Void AppendSeconds(StdString& out, CChar* name, const HttpRoute* route, CChar* key, CChar* value, UInt64 nanoseconds) {
+        AppendLabels(out, name, route, key, value);
+        Char number[32];
+        std::snprintf(number, sizeof(number), " %.9f\n", static_cast<double>(nanoseconds) / 1e9);
+        out += number;
+    }
+};
+
+#endif // HTTP_METRICS_H
@@ -0,0 +1,166 @@
+#ifndef HTTP_PINNED_THREAD_H
+#define HTTP_PINNED_THREAD_H
+
+#include <StandardDefines.h>
+#include "HttpPipelineDefaults.h"
+#include <functional>
+
+#if !defined(ESP_PLATFORM)
+    #include <thread>
+#endif
+
+#if defined(ESP_PLATFORM)
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/task.h>
+#elif defined(_WIN32)
+    // Keep <windows.h> from defining min/max macros and pulling in the rarely used APIs
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <pthread.h>
+    #if defined(__linux__)
+        #include <sched.h>
+    #endif
+#elif HTTP_EXCEPTIONS_ENABLED
+    #include <system_error>
+#endif
+
+/**
+ * Detached threads bound to one core, for HttpExecutionMode::Pinned
+ *
+ * ESP32: a FreeRTOS task created with xTaskCreatePinnedToCore (ESP-IDF cannot move a
+ * running task to another core). Windows / POSIX: a native thread that sets its own
+ * affinity before running the body (Linux and Windows; macOS has no hard affinity, so the
+ * thread runs unpinned there). Threads are created through the native API so a failure is
+ * reported as false, also in builds without exceptions. Cores wrap around the available
+ * count, so a configuration written for a dual-core part also runs on a single-core one.
+ */
+class HttpPinnedThread {
+    Private
+        struct Task {
+            std::function<Void()> body;
+            UInt core;
+        };
+
+    Public
+        /**
+         * @brief Number of cores threads can be pinned to (at least 1)
+         */
+        Static UInt GetCoreCount() {
+#if defined(ESP_PLATFORM)
+            return portNUM_PROCESSORS;
+#else
+            CUInt count = std::thread::hardware_concurrency();
+            return count == 0 ? 1 : count;
+#endif
+        }
+
+        /**
+         * @brief Start a detached thread on a core; it ends when body returns
+         * @param name Thread name (task name on ESP32)
+         * @param core Core index, taken modulo GetCoreCount()
+         * @param body Thread body
+         * @return false if the thread could not be created
+         */
+        Static Bool Start(CChar* name, CUInt core, std::function<Void()> body) {
+            Task* task = new Task{std::move(body), core % GetCoreCount()};
+#if defined(ESP_PLATFORM)
+            if (xTaskCreatePinnedToCore(&RunTask, name, HTTP_PINNED_THREAD_STACK_BYTES, task,
+                                        HTTP_PINNED_THREAD_PRIORITY, nullptr, static_cast<BaseType_t>(task->core)) != pdPASS) {
+                delete task;
+                return false;
+            }
+            return true;
+#elif defined(_WIN32)
+            (void)name;
+            HANDLE thread = CreateThread(nullptr, 0, &RunTask, task, 0, nullptr);
+            if (thread == nullptr) {
+                delete task;
+                return false;
+            }
+            CloseHandle(thread);
+            return true;
+#elif defined(__unix__) || defined(__APPLE__)
+            (void)name;
+            pthread_attr_t attributes;
+            if (pthread_attr_init(&attributes) != 0) {
+                delete task;
+                return false;
+            }
+            pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+            pthread_t thread;
+            CInt result = pthread_create(&thread, &attributes, &RunTask, task);
+            pthread_attr_destroy(&attributes);
+            if (result != 0) {
+                delete task;
+                return false;
+            }
+            return true;
+#else
+            (void)name;
+    #if HTTP_EXCEPTIONS_ENABLED
+            try {
+                std::thread(&RunTask, task).detach();
+            } catch (const std::system_error&) {
+                delete task;
+                return false;
+            }
+    #else
+            std::thread(&RunTask, task).detach();
+    #endif
+            return true;
+#endif
+        }
+
+    Private
+        Static Void RunBody(Task* task) {
+            PinCurrentThread(task->core);
+            task->body();
+            delete task;
+        }
+
+#if defined(ESP_PLATFORM)
+        Static Void RunTask(Void* argument) {
+            RunBody(static_cast<Task*>(argument));
+            vTaskDelete(nullptr);
+        }
+#elif defined(_WIN32)
+        Static DWORD WINAPI RunTask(LPVOID argument) {
+            RunBody(static_cast<Task*>(argument));
+            return 0;
+        }
+#elif defined(__unix__) || defined(__APPLE__)
+        Static Void* RunTask(Void* argument) {
+            RunBody(static_cast<Task*>(argument));
+            return nullptr;
+        }
+#else
+        Static Void RunTask(Task* task) {
+            RunBody(task);
+        }
+#endif
+
+        Static Bool PinCurrentThread(CUInt core) {
+#if defined(ESP_PLATFORM)
+            (void)core;  // pinned at creation
+            return true;
+#elif defined(_WIN32)
+            return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << core) != 0;
+#elif defined(__linux__)
+            cpu_set_t cores;
+            CPU_ZERO(&cores);
+            CPU_SET(core, &cores);
+            return pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores) == 0;
+#else
+            (void)core;
+            return false;
+#endif
+        }
+};
+
+#endif // HTTP_PINNED_THREAD_H
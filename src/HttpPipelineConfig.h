@@ -0,0 +1,207 @@
+#ifndef HTTP_PIPELINE_CONFIG_H
+#define HTTP_PIPELINE_CONFIG_H
+
+#include "IHttpPipelineConfig.h"
+#include "HttpPipelineDefaults.h"
+
+/* @Component */
+class HttpPipelineConfig final : public IHttpPipelineConfig {
+    Private HttpRequestLoopMode loopMode;
+    Private UInt pollingDelayMs;
+    Private UInt idleWaitMs;
+    Private UInt maxRequestsPerPass;
+    Private UInt responseBatchSize;
+    Private UInt cloudResponseBatchSize;
+    Private UInt cloudResponseHighWaterMark;
+    Private UInt requestQueueCapacity;
+    Private UInt responseQueueCapacity;
+    Private HttpQueueOverflowPolicy overflowPolicy;
+    Private UInt workerCount;
+    Private HttpExecutionMode executionMode;
+    Private Int networkCore;
+    Private UInt workerCore;
+    Private UInt keepAliveTimeoutMs;
+    Private UInt keepAliveMaxRequests;
+
+    Public HttpPipelineConfig()
+        : loopMode(HTTP_REQUEST_LOOP_EVENT_DRIVEN ? HttpRequestLoopMode::EventDriven : HttpRequestLoopMode::Polling),
+          pollingDelayMs(HTTP_POLLING_LOOP_DELAY_MS),
+          idleWaitMs(HTTP_EVENT_LOOP_IDLE_WAIT_MS),
+          maxRequestsPerPass(HTTP_MAX_REQUESTS_PER_PASS),
+          responseBatchSize(HTTP_RESPONSE_BATCH_SIZE == 0 ? 1 : HTTP_RESPONSE_BATCH_SIZE),
+          cloudResponseBatchSize(HTTP_CLOUD_RESPONSE_BATCH_SIZE == 0 ? 1 : HTTP_CLOUD_RESPONSE_BATCH_SIZE),
+          cloudResponseHighWaterMark(HTTP_CLOUD_RESPONSE_HIGH_WATER_MARK == 0 ? 1 : HTTP_CLOUD_RESPONSE_HIGH_WATER_MARK),
+          requestQueueCapacity(HTTP_REQUEST_QUEUE_CAPACITY == 0 ? 1 : HTTP_REQUEST_QUEUE_CAPACITY),
+          responseQueueCapacity(HTTP_RESPONSE_QUEUE_CAPACITY == 0 ? 1 : HTTP_RESPONSE_QUEUE_CAPACITY),
+          overflowPolicy(ToOverflowPolicy(HTTP_QUEUE_OVERFLOW_POLICY)),
+          workerCount(HTTP_REQUEST_WORKER_COUNT == 0 ? 1 : HTTP_REQUEST_WORKER_COUNT),
+          executionMode(HTTP_PINNED_EXECUTION ? HttpExecutionMode::Pinned : HttpExecutionMode::Shared),
+          networkCore(HTTP_NETWORK_CORE < 0 ? -1 : HTTP_NETWORK_CORE),
+          workerCore(HTTP_WORKER_CORE),
+          keepAliveTimeoutMs(HTTP_KEEP_ALIVE_TIMEOUT_MS == 0 ? 1 : HTTP_KEEP_ALIVE_TIMEOUT_MS),
+          keepAliveMaxRequests(HTTP_KEEP_ALIVE_MAX_REQUESTS) {
+    }
+
+    Public ~HttpPipelineConfig() override = default;
+
+    // ============================================================================
+    // Request Loop
+    // ============================================================================
+
+    Public HttpRequestLoopMode GetLoopMode() const override {
+        return loopMode;
+    }
+
+    Public Void SetLoopMode(HttpRequestLoopMode mode) override {
+        loopMode = mode;
+    }
+
+    Public UInt GetPollingDelayMs() const override {
+        return pollingDelayMs;
+    }
+
+    Public Void SetPollingDelayMs(CUInt delayMs) override {
+        pollingDelayMs = delayMs;
+    }
+
+    Public UInt GetIdleWaitMs() const override {
+        return idleWaitMs;
+    }
+
+    Public Void SetIdleWaitMs(CUInt waitMs) override {
+        idleWaitMs = waitMs;
+    }
+
+    Public UInt GetMaxRequestsPerPass() const override {
+        return maxRequestsPerPass;
+    }
+
+    Public Void SetMaxRequestsPerPass(CUInt count) override {
+        maxRequestsPerPass = count == 0 ? 1 : count;
+    }
+
+    Public UInt GetResponseBatchSize() const override {
+        return responseBatchSize;
+    }
+
+    Public Void SetResponseBatchSize(CUInt count) override {
+        responseBatchSize = count == 0 ? 1 : count;
+    }
+
+    Public UInt GetCloudResponseBatchSize() const override {
+        return cloudResponseBatchSize;
+    }
+
+    Public Void SetCloudResponseBatchSize(CUInt count) override {
+        cloudResponseBatchSize = count == 0 ? 1 : count;
+    }
+
+    Public UInt GetCloudResponseHighWaterMark() const override {
+        return cloudResponseHighWaterMark;
+    }
+
+    Public Void SetCloudResponseHighWaterMark(CUInt count) override {
+        cloudResponseHighWaterMark = count == 0 ? 1 : count;
+    }
+
+    // ============================================================================
+    // Queues
+    // ============================================================================
+
+    Public UInt GetRequestQueueCapacity() const override {
+        return requestQueueCapacity;
+    }
+
+    Public Void SetRequestQueueCapacity(CUInt capacity) override {
+        requestQueueCapacity = capacity == 0 ? 1 : capacity;
+    }
+
+    Public UInt GetResponseQueueCapacity() const override {
+        return responseQueueCapacity;
+    }
+
+    Public Void SetResponseQueueCapacity(CUInt capacity) override {
+        responseQueueCapacity = capacity == 0 ? 1 : capacity;
+    }
+
+    Public HttpQueueOverflowPolicy GetOverflowPolicy() const override {
+        return overflowPolicy;
+    }
+
+    Public Void SetOverflowPolicy(HttpQueueOverflowPolicy policy) override {
+        overflowPolicy = policy;
+    }
+
+    // ============================================================================
+    // Request Workers
+    // ============================================================================
+
+    Public UInt GetWorkerCount() const override {
+        return workerCount;
+    }
+
+    Public Void SetWorkerCount(CUInt count) override {
+        workerCount = count == 0 ? 1 : count;
+    }
+
+    // ============================================================================
+    // Core Affinity
+    // ============================================================================
+
+    Public HttpExecutionMode GetExecutionMode() const override {
+        return executionMode;
+    }
+
+    Public Void SetExecutionMode(HttpExecutionMode mode) override {
+        executionMode = mode;
+    }
+
+    Public Int GetNetworkCore() const override {
+        return networkCore;
+    }
+
+    Public Void SetNetworkCore(CInt core) override {
+        networkCore = core < 0 ? -1 : core;
+    }
+
+    Public UInt GetWorkerCore() const override {
+        return workerCore;
+    }
+
+    Public Void SetWorkerCore(CUInt core) override {
+        workerCore = core;
+    }
+
+    // ============================================================================
+    // Connections
+    // ============================================================================
+
+    Public UInt GetKeepAliveTimeoutMs() const override {
+        return keepAliveTimeoutMs;
+    }
+
+    Public Void SetKeepAliveTimeoutMs(CUInt timeoutMs) override {
+        keepAliveTimeoutMs = timeoutMs == 0 ? 1 : timeoutMs;
+    }
+
+    Public UInt GetKeepAliveMaxRequests() const override {
+        return keepAliveMaxRequests;
+    }
+
+    Public Void SetKeepAliveMaxRequests(CUInt count) override {
+        keepAliveMaxRequests = count;
+    }
+
+    Private Static HttpQueueOverflowPolicy ToOverflowPolicy(Int value) {
+        switch (value) {
+            case HTTP_QUEUE_OVERFLOW_BLOCK:
+                return HttpQueueOverflowPolicy::Block;
+            case HTTP_QUEUE_OVERFLOW_DROP_OLDEST:
+                return HttpQueueOverflowPolicy::DropOldest;
+            default:
+                return HttpQueueOverflowPolicy::RejectWithServiceUnavailable;
+        }
+    }
+};
+
+#endif // HTTP_PIPELINE_CONFIG_H
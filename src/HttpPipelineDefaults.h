@@ -0,0 +1,328 @@
+#ifndef HTTP_PIPELINE_DEFAULTS_H
+#define HTTP_PIPELINE_DEFAULTS_H
+
+/**
+ * Compile-time defaults for the HTTP request pipeline.
+ *
+ * Every value can be overridden with a build flag (e.g. -DHTTP_EVENT_LOOP_IDLE_WAIT_MS=5
+ * in platformio.ini build_flags or target_compile_definitions in CMake) and most of them
+ * can also be changed at runtime through IHttpPipelineConfig.
+ */
+
+// ============================================================================
+// Request loop
+// ============================================================================
+
+// 1 = event-driven loop (default), 0 = legacy fixed-delay polling loop
+#ifndef HTTP_REQUEST_LOOP_EVENT_DRIVEN
+#define HTTP_REQUEST_LOOP_EVENT_DRIVEN 1
+#endif
+
+// Delay between iterations of the polling loop
+#ifndef HTTP_POLLING_LOOP_DELAY_MS
+#define HTTP_POLLING_LOOP_DELAY_MS 1000
+#endif
+
+// Longest time the event-driven loop sleeps when both servers and both queues are idle
+#ifndef HTTP_EVENT_LOOP_IDLE_WAIT_MS
+#define HTTP_EVENT_LOOP_IDLE_WAIT_MS 10
+#endif
+
+// Upper bound of requests accepted from each server in a single loop pass
+#ifndef HTTP_MAX_REQUESTS_PER_PASS
+#define HTTP_MAX_REQUESTS_PER_PASS 16
+#endif
+
+// Responses taken off the response queue per batch
+#ifndef HTTP_RESPONSE_BATCH_SIZE
+#define HTTP_RESPONSE_BATCH_SIZE 16
+#endif
+
+// Cloud responses sent per loop pass; a slow cloud link cannot starve local clients
+#ifndef HTTP_CLOUD_RESPONSE_BATCH_SIZE
+#define HTTP_CLOUD_RESPONSE_BATCH_SIZE 8
+#endif
+
+// Cloud queue length at which the request manager stops admitting requests until the
+// cloud link catches up (responses are never dropped)
+#ifndef HTTP_CLOUD_RESPONSE_HIGH_WATER_MARK
+#define HTTP_CLOUD_RESPONSE_HIGH_WATER_MARK 32
+#endif
+
+// ============================================================================
+// Request workers
+// ============================================================================
+
+// Number of IThreadPool workers dispatching requests concurrently.
+// 1 = dispatch inline on the loop thread (no thread pool involved)
+#ifndef HTTP_REQUEST_WORKER_COUNT
+#define HTTP_REQUEST_WORKER_COUNT 1
+#endif
+
+// Bytes of the per-request arena kept on the worker's stack; allocations beyond
+// it go to heap blocks of HTTP_REQUEST_ARENA_BLOCK_BYTES, all freed with the request
+#ifndef HTTP_REQUEST_ARENA_BYTES
+#define HTTP_REQUEST_ARENA_BYTES 512
+#endif
+
+#ifndef HTTP_REQUEST_ARENA_BLOCK_BYTES
+#define HTTP_REQUEST_ARENA_BLOCK_BYTES 1024
+#endif
+
+// ============================================================================
+// Core affinity
+// ============================================================================
+
+// 1 = pinned execution: HttpRequestManager::StartServer starts a network thread (receive
+// and send) and HTTP_REQUEST_WORKER_COUNT dispatch threads, each bound to a core;
+// 0 = shared execution, everything runs on the thread calling RetrieveRequest
+#ifndef HTTP_PINNED_EXECUTION
+#define HTTP_PINNED_EXECUTION 0
+#endif
+
+// Core of the network thread. On ESP32 core 0 also runs the WiFi stack, which is what
+// the servers talk to. -1 = no network thread, the caller keeps calling RetrieveRequest
+#ifndef HTTP_NETWORK_CORE
+#define HTTP_NETWORK_CORE 0
+#endif
+
+// Core of the first dispatch thread; worker i runs on (HTTP_WORKER_CORE + i) modulo
+// the core count, so workers spread over the cores the network thread leaves free
+#ifndef HTTP_WORKER_CORE
+#define HTTP_WORKER_CORE 1
+#endif
+
+// FreeRTOS stack and priority of the pinned tasks (ESP32 only). The stack holds the
+// HTTP_REQUEST_ARENA_BYTES arena and the deepest handler
+#ifndef HTTP_PINNED_THREAD_STACK_BYTES
+#define HTTP_PINNED_THREAD_STACK_BYTES 8192
+#endif
+
+#ifndef HTTP_PINNED_THREAD_PRIORITY
+#define HTTP_PINNED_THREAD_PRIORITY 1
+#endif
+
+// ============================================================================
+// Routing
+// ============================================================================
+
+// Longest request path, in segments, that the endpoint trie will try to match
+#ifndef HTTP_ROUTE_MAX_SEGMENTS
+#define HTTP_ROUTE_MAX_SEGMENTS 32
+#endif
+
+// Most path variables a single route may capture
+#ifndef HTTP_ROUTE_MAX_VARIABLES
+#define HTTP_ROUTE_MAX_VARIABLES 8
+#endif
+
+// 1 = look up fully literal routes (no {variable}) in a perfect hash of method + path
+// before walking the trie; 0 = every request goes through the trie
+#ifndef HTTP_ROUTE_LITERAL_HASH
+#define HTTP_ROUTE_LITERAL_HASH 1
+#endif
+
+// ============================================================================
+// Queues
+// ============================================================================
+
+// 1 = use the lock-free ring buffer queues (LockFreeHttpRequestQueue /
+// LockFreeHttpResponseQueue) instead of the mutex-based ones
+#ifndef HTTP_USE_LOCK_FREE_QUEUES
+#define HTTP_USE_LOCK_FREE_QUEUES 0
+#endif
+
+// Maximum queued requests. For the lock-free queue this is also the ring size
+// (rounded up to a power of two); the runtime setting can only lower it
+#ifndef HTTP_REQUEST_QUEUE_CAPACITY
+#define HTTP_REQUEST_QUEUE_CAPACITY 64
+#endif
+
+// Queued responses, per local/cloud queue, at which the request manager stops admitting
+// requests; responses themselves are never dropped
+#ifndef HTTP_RESPONSE_QUEUE_CAPACITY
+#define HTTP_RESPONSE_QUEUE_CAPACITY 64
+#endif
+
+// Ring size of each lock-free response queue (rounded up to a power of two): the
+// capacity above plus every response still produced once admission has paused, i.e. a
+// full request queue, one per worker and one 503
+#ifndef HTTP_RESPONSE_QUEUE_SLOTS
+#define HTTP_RESPONSE_QUEUE_SLOTS (HTTP_RESPONSE_QUEUE_CAPACITY + HTTP_REQUEST_QUEUE_CAPACITY + HTTP_REQUEST_WORKER_COUNT + 1)
+#endif
+
+// What the request manager does with a new request when the request queue is full
+#define HTTP_QUEUE_OVERFLOW_BLOCK 0           // leave requests in the server until there is room
+#define HTTP_QUEUE_OVERFLOW_DROP_OLDEST 1     // discard the oldest queued request
+#define HTTP_QUEUE_OVERFLOW_REJECT 2          // answer 503 Service Unavailable right away
+#ifndef HTTP_QUEUE_OVERFLOW_POLICY
+#define HTTP_QUEUE_OVERFLOW_POLICY HTTP_QUEUE_OVERFLOW_REJECT
+#endif
+
+// ============================================================================
+// Response Writing
+// ============================================================================
+
+// 1 = response processors render responses with HttpResponseWriter into a reused
+// buffer; 0 = use IHttpResponse::ToHttpString() (one fresh string per response)
+#ifndef HTTP_RESPONSE_DIRECT_WRITE
+#define HTTP_RESPONSE_DIRECT_WRITE 1
+#endif
+
+// Largest buffer a response writer keeps between sends; a bigger response is
+// rendered normally but its storage is released afterwards
+#ifndef HTTP_RESPONSE_WRITER_RETAIN_BYTES
+#define HTTP_RESPONSE_WRITER_RETAIN_BYTES 4096
+#endif
+
+// 1 = responses are created in preallocated slots (HttpResponsePool) and recycled
+// once sent; 0 = one heap allocation per response
+#ifndef HTTP_RESPONSE_POOL
+#define HTTP_RESPONSE_POOL 1
+#endif
+
+// Pooled responses: a full local response queue plus the one each worker is building.
+// Responses beyond it are allocated on the heap
+#ifndef HTTP_RESPONSE_POOL_SLOTS
+#define HTTP_RESPONSE_POOL_SLOTS (HTTP_RESPONSE_QUEUE_CAPACITY + HTTP_REQUEST_WORKER_COUNT)
+#endif
+
+// ============================================================================
+// Response Cache
+// ============================================================================
+
+// Most responses of @Cacheable routes kept at once (one per request path); when
+// full, the entry closest to expiry is evicted
+#ifndef HTTP_RESPONSE_CACHE_MAX_ENTRIES
+#define HTTP_RESPONSE_CACHE_MAX_ENTRIES 16
+#endif
+
+// Bodies larger than this are sent but never cached
+#ifndef HTTP_RESPONSE_CACHE_MAX_BODY_BYTES
+#define HTTP_RESPONSE_CACHE_MAX_BODY_BYTES 4096
+#endif
+
+// ============================================================================
+// Response Compression
+// ============================================================================
+
+// 1 = gzip/deflate responses for clients that accept it (Accept-Encoding), except on
+// @NoCompression routes; 0 = always send bodies uncompressed
+#ifndef HTTP_RESPONSE_COMPRESSION
+#define HTTP_RESPONSE_COMPRESSION 1
+#endif
+
+// Bodies smaller than this are sent uncompressed (framing would eat the gain)
+#ifndef HTTP_COMPRESSION_MIN_BYTES
+#define HTTP_COMPRESSION_MIN_BYTES 512
+#endif
+
+// LZ77 window of the encoder (power of two, 256..32768); state is ~4 bytes per window byte
+#ifndef HTTP_COMPRESSION_WINDOW_BYTES
+#define HTTP_COMPRESSION_WINDOW_BYTES 4096
+#endif
+
+// Compressed bodies of responses carrying an ETag (cached responses) kept for reuse
+#ifndef HTTP_COMPRESSION_MEMO_ENTRIES
+#define HTTP_COMPRESSION_MEMO_ENTRIES 8
+#endif
+
+// ============================================================================
+// Connections (keep-alive)
+// ============================================================================
+
+// How long an idle keep-alive connection stays tracked (and the timeout advertised
+// in the Keep-Alive response header)
+#ifndef HTTP_KEEP_ALIVE_TIMEOUT_MS
+#define HTTP_KEEP_ALIVE_TIMEOUT_MS 5000
+#endif
+
+// Responses sent on one connection before it is closed; 0 disables keep-alive. Off by
+// default: IServer closes the socket after each response, so advertising keep-alive would
+// make clients wait on a connection that is already gone. Raise it for servers that keep
+// connections open
+#ifndef HTTP_KEEP_ALIVE_MAX_REQUESTS
+#define HTTP_KEEP_ALIVE_MAX_REQUESTS 0
+#endif
+
+// Connections kept alive at once; requests on further connections are answered with
+// Connection: close (bounds socket usage on devices)
+#ifndef HTTP_KEEP_ALIVE_MAX_CONNECTIONS
+#define HTTP_KEEP_ALIVE_MAX_CONNECTIONS 4
+#endif
+
+// ============================================================================
+// Metrics
+// ============================================================================
+
+// 1 = count requests per route, time the pipeline stages and serve them at
+// HTTP_METRICS_PATH; 0 = no instrumentation is compiled in
+#ifndef HTTP_METRICS_ENABLED
+#define HTTP_METRICS_ENABLED 0
+#endif
+
+// Path of the built-in metrics endpoint (Prometheus text format, GET only); a
+// controller route with the same path takes precedence
+#ifndef HTTP_METRICS_PATH
+#define HTTP_METRICS_PATH "/metrics"
+#endif
+
+// Routes with their own counters and latency histogram; requests of further routes
+// are only counted in the untracked total
+#ifndef HTTP_METRICS_MAX_ROUTES
+#define HTTP_METRICS_MAX_ROUTES 32
+#endif
+
+// ============================================================================
+// Logging
+// ============================================================================
+
+// Most verbose level compiled in. HTTP_LOG_* calls above it expand to nothing, so their
+// arguments are never evaluated and no message is formatted
+#define HTTP_LOG_LEVEL_NONE 0
+#define HTTP_LOG_LEVEL_ERROR 1
+#define HTTP_LOG_LEVEL_WARNING 2
+#define HTTP_LOG_LEVEL_INFO 3
+#define HTTP_LOG_LEVEL_DEBUG 4   // per-request traces
+#ifndef HTTP_LOG_LEVEL
+#define HTTP_LOG_LEVEL HTTP_LOG_LEVEL_INFO
+#endif
+
+// 1 = records are formatted into a ring buffer and handed to ILogger by the request loop
+// after responses are sent (a slow Serial sink never delays a response); 0 = ILogger is
+// called on the logging thread
+#ifndef HTTP_LOG_ASYNC
+#define HTTP_LOG_ASYNC 1
+#endif
+
+// Records the ring holds; when it is full new records are dropped and counted
+#ifndef HTTP_LOG_RING_ENTRIES
+#define HTTP_LOG_RING_ENTRIES 32
+#endif
+
+// Longest formatted message, including the terminator; longer ones are truncated
+#ifndef HTTP_LOG_MESSAGE_BYTES
+#define HTTP_LOG_MESSAGE_BYTES 96
+#endif
+
+// Records handed to ILogger per loop pass
+#ifndef HTTP_LOG_DRAIN_BATCH
+#define HTTP_LOG_DRAIN_BATCH 8
+#endif
+
+// ============================================================================
+// Error Handling
+// ============================================================================
+
+// 1 = the dispatcher catches exceptions escaping handlers and answers 500, and
+// HttpRequestDispatcher::ConvertToType throws on invalid input; 0 = no throw/catch
+// in the dispatch path (builds with -fno-exceptions). Follows the compiler by default
+#ifndef HTTP_EXCEPTIONS_ENABLED
+    #if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+        #define HTTP_EXCEPTIONS_ENABLED 1
+    #else
+        #define HTTP_EXCEPTIONS_ENABLED 0
+    #endif
+#endif
+
+#endif // HTTP_PIPELINE_DEFAULTS_H
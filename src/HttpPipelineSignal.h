@@ -0,0 +1,42 @@
+#ifndef HTTP_PIPELINE_SIGNAL_H
+#define HTTP_PIPELINE_SIGNAL_H
+
+#include "IHttpPipelineSignal.h"
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+/* @Component */
+class HttpPipelineSignal final : public IHttpPipelineSignal {
+    Private std::mutex signalMutex;
+    Private std::condition_variable signalCondition;
+    Private Bool pending;
+
+    Public HttpPipelineSignal() : pending(false) {
+    }
+
+    Public ~HttpPipelineSignal() override = default;
+
+    // ============================================================================
+    // HTTP Pipeline Signal Operations (thread-safe)
+    // ============================================================================
+
+    Public Void Notify() override {
+        {
+            std::lock_guard<std::mutex> lock(signalMutex);
+            pending = true;
+        }
+        signalCondition.notify_one();
+    }
+
+    Public Bool Wait(CUInt timeoutMs) override {
+        std::unique_lock<std::mutex> lock(signalMutex);
+        Bool notified = signalCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() {
+            return pending;
+        });
+        pending = false;
+        return notified;
+    }
+};
+
+#endif // HTTP_PIPELINE_SIGNAL_H
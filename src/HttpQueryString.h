@@ -0,0 +1,89 @@
+#ifndef HTTP_QUERY_STRING_H
+#define HTTP_QUERY_STRING_H
+
+#include <StandardDefines.h>
+#include <string_view>
+
+/**
+ * Lazy view of a URL query string ("page=2&sort=name")
+ *
+ * Nothing is parsed up front: a lookup walks the '&'-separated pairs of the view and
+ * returns the raw (still URL-encoded) value as a slice of the request URL. Only the
+ * parameters a handler asks for are ever decoded, by TryConvertToType. Names are compared
+ * as written in the URL; the first occurrence of a repeated name wins.
+ */
+class HttpQueryString {
+    Private std::string_view query;
+
+    Public HttpQueryString() = default;
+
+    Public explicit HttpQueryString(std::string_view query) : query(query) {
+    }
+
+    /**
+     * @brief Split a request target into path and query string at the first '?'
+     * @param url Request target as received, e.g. "/api/user?page=2"
+     * @param path Receives the part before '?' (the whole url if there is none)
+     * @return The part after '?', empty if there is none
+     */
+    Public Static std::string_view SplitUrl(std::string_view url, std::string_view& path) {
+        Size separator = url.find('?');
+        if (separator == std::string_view::npos) {
+            path = url;
+            return std::string_view();
+        }
+        path = url.substr(0, separator);
+        return url.substr(separator + 1);
+    }
+
+    /**
+     * @brief Find a parameter without allocating
+     * @param name Parameter name, e.g. "page"
+     * @param value Receives the raw value; empty for "?flag" and "?flag="
+     * @return false if the query string has no such parameter
+     */
+    Public Bool TryGet(std::string_view name, std::string_view& value) const {
+        Size start = 0;
+        while (start <= query.length()) {
+            Size end = query.find('&', start);
+            if (end == std::string_view::npos) {
+                end = query.length();
+            }
+            std::string_view pair = query.substr(start, end - start);
+            Size equals = pair.find('=');
+            if (pair.substr(0, equals) == name && !pair.empty()) {
+                value = equals == std::string_view::npos ? std::string_view() : pair.substr(equals + 1);
+                return true;
+            }
+            start = end + 1;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Raw (URL-encoded) value of a parameter, empty if absent
+     */
+    Public std::string_view Get(std::string_view name) const {
+        std::string_view value;
+        TryGet(name, value);
+        return value;
+    }
+
+    Public Bool Has(std::string_view name) const {
+        std::string_view value;
+        return TryGet(name, value);
+    }
+
+    /**
+     * @brief The whole query string, without the leading '?'
+     */
+    Public std::string_view GetRaw() const {
+        return query;
+    }
+
+    Public Bool IsEmpty() const {
+        return query.empty();
+    }
+};
+
+#endif // HTTP_QUERY_STRING_H
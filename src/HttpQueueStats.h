@@ -0,0 +1,19 @@
+#ifndef HTTP_QUEUE_STATS_H
+#define HTTP_QUEUE_STATS_H
+
+#include <StandardDefines.h>
+
+/**
+ * Snapshot of a queue's depth counters, for monitoring
+ */
+struct HttpQueueStats {
+    Size depth;          // Items currently queued
+    Size capacity;       // Configured limit
+    Size highWaterMark;  // Largest depth observed since start
+    Size dropped;        // Items discarded to make room (drop-oldest)
+    Size rejected;       // Items refused because the queue was full
+
+    HttpQueueStats() : depth(0), capacity(0), highWaterMark(0), dropped(0), rejected(0) {}
+};
+
+#endif // HTTP_QUEUE_STATS_H
@@ -0,0 +1,169 @@
+#ifndef HTTP_REQUEST_ARENA_H
+#define HTTP_REQUEST_ARENA_H
+
+#include <StandardDefines.h>
+#include "HttpPipelineDefaults.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * Monotonic allocator for the temporaries of one request
+ *
+ * Allocation bumps a pointer through an inline buffer (HTTP_REQUEST_ARENA_BYTES), then
+ * through heap blocks of HTTP_REQUEST_ARENA_BLOCK_BYTES (or larger for big requests).
+ * Nothing is freed individually: Reset() or destruction releases everything at once, so
+ * request temporaries never leave holes between long-lived heap objects. Not thread-safe;
+ * each worker uses its own arena for the request it handles.
+ */
+class HttpRequestArena {
+    struct Block {
+        Block* next;
+        Size capacity;
+    };
+
+    Private alignas(std::max_align_t) UInt8 storage[HTTP_REQUEST_ARENA_BYTES];
+    Private UInt8* cursor;
+    Private UInt8* limit;
+    Private Block* blocks;  // Heap blocks, most recent first
+    Private Size bytesAllocated;
+
+    Public HttpRequestArena()
+        : cursor(storage), limit(storage + sizeof(storage)), blocks(nullptr), bytesAllocated(0) {
+    }
+
+    HttpRequestArena(const HttpRequestArena&) = delete;
+    HttpRequestArena& operator=(const HttpRequestArena&) = delete;
+
+    Public ~HttpRequestArena() {
+        ReleaseBlocks();
+    }
+
+    /**
+     * @brief Allocate uninitialized memory that lives until Reset()
+     * @param bytes Size of the allocation
+     * @param alignment Power-of-two alignment
+     * @return Pointer into the arena, never nullptr (throws std::bad_alloc or aborts when
+     *         the heap is exhausted, like operator new)
+     */
+    Public Void* Allocate(CSize bytes, CSize alignment = alignof(std::max_align_t)) {
+        UInt8* aligned = Align(cursor, alignment);
+        if (aligned > limit || static_cast<Size>(limit - aligned) < bytes) {
+            Grow(bytes + alignment);
+            aligned = Align(cursor, alignment);
+        }
+        cursor = aligned + bytes;
+        bytesAllocated += bytes;
+        return aligned;
+    }
+
+    /**
+     * @brief Release every allocation; heap blocks are returned to the system
+     */
+    Public Void Reset() {
+        ReleaseBlocks();
+        cursor = storage;
+        limit = storage + sizeof(storage);
+        bytesAllocated = 0;
+    }
+
+    /**
+     * @brief Bytes handed out since construction or the last Reset()
+     */
+    Public Size GetBytesAllocated() const {
+        return bytesAllocated;
+    }
+
+    /**
+     * @brief True when the inline buffer was too small and heap blocks were used
+     *        (a hint to raise HTTP_REQUEST_ARENA_BYTES)
+     */
+    Public Bool HasOverflowed() const {
+        return blocks != nullptr;
+    }
+
+    Private Static UInt8* Align(UInt8* pointer, CSize alignment) {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+        return reinterpret_cast<UInt8*>((address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+    }
+
+    Private Void Grow(CSize minimum) {
+        Size capacity = minimum > HTTP_REQUEST_ARENA_BLOCK_BYTES ? minimum : HTTP_REQUEST_ARENA_BLOCK_BYTES;
+        Size header = (sizeof(Block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        Block* block = static_cast<Block*>(std::malloc(header + capacity));
+        if (block == nullptr) {
+#if HTTP_EXCEPTIONS_ENABLED
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+        block->next = blocks;
+        block->capacity = capacity;
+        blocks = block;
+        cursor = reinterpret_cast<UInt8*>(block) + header;
+        limit = cursor + capacity;
+    }
+
+    Private Void ReleaseBlocks() {
+        while (blocks != nullptr) {
+            Block* next = blocks->next;
+            std::free(blocks);
+            blocks = next;
+        }
+    }
+};
+
+/**
+ * Standard allocator over an HttpRequestArena; deallocate is a no-op
+ */
+template<typename T>
+class HttpArenaAllocator {
+    Private HttpRequestArena* arena;
+
+    template<typename U>
+    friend class HttpArenaAllocator;
+
+    Public using value_type = T;
+
+    Public explicit HttpArenaAllocator(HttpRequestArena& arena) noexcept
+        : arena(&arena) {
+    }
+
+    Public template<typename U>
+    HttpArenaAllocator(const HttpArenaAllocator<U>& other) noexcept
+        : arena(other.arena) {
+    }
+
+    Public T* allocate(CSize count) {
+        return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    Public Void deallocate(T*, Size) noexcept {
+    }
+
+    Public HttpRequestArena& GetArena() const noexcept {
+        return *arena;
+    }
+
+    Public template<typename U>
+    Bool operator==(const HttpArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    Public template<typename U>
+    Bool operator!=(const HttpArenaAllocator<U>& other) const noexcept {
+        return arena != other.arena;
+    }
+};
+
+// Containers for request temporaries, e.g. ArenaString text{HttpArenaAllocator<Char>(arena)};
+using ArenaString = std::basic_string<Char, std::char_traits<Char>, HttpArenaAllocator<Char>>;
+
+template<typename T>
+using ArenaVector = std::vector<T, HttpArenaAllocator<T>>;
+
+#endif // HTTP_REQUEST_ARENA_H
@@ -0,0 +1,121 @@
+#ifndef HTTP_REQUEST_CONTEXT_H
+#define HTTP_REQUEST_CONTEXT_H
+
+#include <StandardDefines.h>
+#include "EndpointMatcher.h"
+#include "HttpRequestArena.h"
+#include "HttpQueryString.h"
+#include <string_view>
+
+/**
+ * Read-only view of the request handed to a route handler
+ *
+ * Nothing is copied: the body is referenced, path variables are slices of the request
+ * path described by the route match, and query parameters are looked up lazily in the
+ * query string. The context is only valid for the duration of the
+ * handler call, and so are allocations from its arena.
+ */
+class HttpRequestContext {
+    Private CStdString& body;
+    Private std::string_view path;
+    Private const EndpointMatch& match;
+    Private HttpRequestArena& arena;
+    Private HttpQueryString query;
+
+    Public HttpRequestContext(CStdString& body, std::string_view path, const EndpointMatch& match, HttpRequestArena& arena,
+                              std::string_view query = std::string_view())
+        : body(body), path(path), match(match), arena(arena), query(query) {
+    }
+
+    HttpRequestContext(const HttpRequestContext&) = delete;
+    HttpRequestContext& operator=(const HttpRequestContext&) = delete;
+
+    /**
+     * @brief Request body, for deserialization
+     */
+    Public CStdString& GetBody() const {
+        return body;
+    }
+
+    /**
+     * @brief Request body as a view
+     */
+    Public std::string_view GetBodyView() const {
+        return body;
+    }
+
+    /**
+     * @brief Matched request path (still URL-encoded, without the query string)
+     */
+    Public std::string_view GetPath() const {
+        return path;
+    }
+
+    /**
+     * @brief Raw (URL-encoded) value of a path variable
+     * @param name Variable name as written in the route pattern, e.g. "userId"
+     * @return Slice of the request path, empty if the route has no such variable
+     */
+    Public std::string_view GetPathVariable(std::string_view name) const {
+        return match.GetVariable(path, name);
+    }
+
+    /**
+     * @brief Check whether the matched route captured a variable
+     */
+    Public Bool HasPathVariable(std::string_view name) const {
+        for (Size i = 0; i < match.captureCount; i++) {
+            if (match.captures[i].name == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Public Size GetPathVariableCount() const {
+        return match.captureCount;
+    }
+
+    /**
+     * @brief Raw (URL-encoded) value of a query parameter
+     * @param name Parameter name, e.g. "page" for "?page=2"
+     * @param value Receives a slice of the query string
+     * @return false if the request has no such parameter
+     */
+    Public Bool TryGetQueryParameter(std::string_view name, std::string_view& value) const {
+        return query.TryGet(name, value);
+    }
+
+    /**
+     * @brief Raw (URL-encoded) value of a query parameter, empty if absent
+     */
+    Public std::string_view GetQueryParameter(std::string_view name) const {
+        return query.Get(name);
+    }
+
+    Public Bool HasQueryParameter(std::string_view name) const {
+        return query.Has(name);
+    }
+
+    Public const HttpQueryString& GetQuery() const {
+        return query;
+    }
+
+    /**
+     * @brief Arena for the handler's temporaries (ArenaString, ArenaVector, ...), released
+     *        in one shot once the request has been dispatched. The generated handlers decode
+     *        path variables and query parameters into it
+     */
+    Public HttpRequestArena& GetArena() const {
+        return arena;
+    }
+
+    /**
+     * @brief Copy all path variables into a map (allocates; for code that needs owned strings)
+     */
+    Public StdMap<StdString, StdString> GetPathVariables() const {
+        return match.ToVariables(path);
+    }
+};
+
+#endif // HTTP_REQUEST_CONTEXT_H
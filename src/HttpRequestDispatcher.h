@@ -4,341 +4,594 @@
 #include <unordered_map>
 #include <NayanSerializer.h>
 #include "EndpointTrie.h"
+#include "CompiledEndpointTrie.h"
+#include "LiteralRouteTable.h"
+#include "HttpRoute.h"
+#include "HttpRequestContext.h"
+#include "HttpQueryString.h"
+#include "HttpBodyStream.h"
+#include "HttpErrorResponse.h"
+#include "HttpResponsePool.h"
+#include "HttpPipelineDefaults.h"
 #include <StandardDefines.h>
-#include <sstream>
 #include <stdexcept>
 #include <type_traits>
-#include <algorithm>
-#include <cctype>
-#include <iomanip>
+#include <string_view>
+#include <charconv>
+#include <system_error>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 
 #ifdef ARDUINO
     #include <Arduino.h>
-    #define std_print(x) Serial.print(x)
-    #define std_println(x) Serial.println(x)
-#else
-    #include <iostream>
-    #define std_print(x) std::cout << x
-    #define std_println(x) std::cout << x << std::endl
 #endif
 
 #include "IHttpRequestDispatcher.h"
+#include "IHttpResponseCache.h"
+#include "IHttpResponseCompressor.h"
+#include "IHttpMetrics.h"
 #include <IHttpResponse.h>
 #include "ResponseEntityToHttpResponse.h"
 
 /* @Component */
 class HttpRequestDispatcher : public IHttpRequestDispatcher {
 
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> getMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> postMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> putMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> patchMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> deleteMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> optionsMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> headMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> traceMappings;
-    Private StdUnorderedMap<StdString, std::function<IHttpResponsePtr(CStdString, StdMap<StdString, StdString>)>> connectMappings;
+    // Routes live in static tables (the one generated into InitializeMappings() plus any
+    // registered later); each compiled endpoint points at its per-method routes, so one
+    // walk yields the handler
+    Private StdVector<std::pair<const HttpRoute*, Size>> routeTables;
+    Private CompiledEndpointTrie compiledTrie;
+#if HTTP_ROUTE_LITERAL_HASH
+    // Fully literal routes, consulted before the trie
+    Private LiteralRouteTable literalRoutes;
+#endif
+
+    /* @Autowired */
+    Private IHttpResponseCachePtr responseCache;
 
-    Private EndpointTrie endpointTrie;
+    /* @Autowired */
+    Private IHttpResponseCompressorPtr responseCompressor;
+
+#if HTTP_METRICS_ENABLED
+    /* @Autowired */
+    Private IHttpMetricsPtr metrics;
+#endif
 
     Public HttpRequestDispatcher() {
         InitializeMappings();
-        InsertMappingsToTrie();
     }
 
     Public ~HttpRequestDispatcher() = default;
 
     Public IHttpResponsePtr DispatchRequest(IHttpRequestPtr request) override {
-        CStdString url = request->GetPath();
-        CStdString payload = request->GetBody();
-        
-        EndpointMatchResult result = endpointTrie.Search(url);
-        if(result.found == false) {
-            // Return 404 Not Found
-            StdString errorJson = "{\"error\":\"Not Found\",\"message\":\"No pattern matched for URL: " + url + "\"}";
-            ResponseEntity<StdString> errorResponse = ResponseEntity<StdString>::NotFound(errorJson);
-            IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(errorResponse);
-            StdString requestId = StdString(request->GetRequestId());
-            if (!requestId.empty()) {
-                response->SetRequestId(requestId);
-            }
-            return response;
-        }
-        
-        Val variables = result.variables;
-        Val patternUrl = result.pattern;
+        HttpRequestArena arena;
+        return DispatchRequest(std::move(request), arena);
+    }
+
+    Public IHttpResponsePtr DispatchRequest(IHttpRequestPtr request, HttpRequestArena& arena) override {
+        // Bound by reference: no copy when the request hands out its own strings, lifetime
+        // extension when it returns them by value
+        CStdString& url = request->GetPath();
+        CStdString& payload = request->GetBody();
         
         // Get request ID from the request
         StdString requestId = StdString(request->GetRequestId());
 
-        try {
-            IHttpResponsePtr response = nullptr;
-            
-            switch (request->GetMethod()) {
-                case HttpMethod::GET:
-                    if (getMappings.find(patternUrl) == getMappings.end()) {
-                        return nullptr;
-                    }
-                    response = getMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::POST:
-                    if (postMappings.find(patternUrl) == postMappings.end()) {
-                        return nullptr;
-                    }
-                    response = postMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::PUT:
-                    if (putMappings.find(patternUrl) == putMappings.end()) {
-                        return nullptr;
-                    }
-                    response = putMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::PATCH:
-                    if (patchMappings.find(patternUrl) == patchMappings.end()) {
-                        return nullptr;
-                    }
-                    response = patchMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::DELETE:
-                    if (deleteMappings.find(patternUrl) == deleteMappings.end()) {
-                        return nullptr;
-                    }
-                    response = deleteMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::OPTIONS:
-                    if (optionsMappings.find(patternUrl) == optionsMappings.end()) {
-                        return nullptr;
-                    }
-                    response = optionsMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::HEAD:
-                    if (headMappings.find(patternUrl) == headMappings.end()) {
-                        return nullptr;
-                    }
-                    response = headMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::TRACE:
-                    if (traceMappings.find(patternUrl) == traceMappings.end()) {
-                        return nullptr;
-                    }
-                    response = traceMappings[patternUrl](payload, variables);
-                    break;
-                case HttpMethod::CONNECT:
-                    if (connectMappings.find(patternUrl) == connectMappings.end()) {
-                        return nullptr;
-                    }
-                    response = connectMappings[patternUrl](payload, variables);
-                    break;
+        // Only GET routes are cacheable, so only GET requests can be answered with 304
+        HttpMethod method = request->GetMethod();
+        CStdString ifNoneMatch = method == HttpMethod::GET ? request->GetHeader("If-None-Match") : StdString();
+#if HTTP_RESPONSE_COMPRESSION
+        CStdString acceptEncoding = request->GetHeader("Accept-Encoding");
+#else
+        CStdString acceptEncoding;
+#endif
+
+        return DispatchInternal(method, url, payload, requestId, ifNoneMatch, acceptEncoding, arena);
+    }
+
+    Public IHttpResponsePtr Dispatch(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch) override {
+        HttpRequestArena arena;
+        return Dispatch(method, url, payload, requestId, ifNoneMatch, arena);
+    }
+
+    Public IHttpResponsePtr Dispatch(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch, HttpRequestArena& arena) override {
+        // No request headers here: responses go out uncompressed
+        return DispatchInternal(method, url, payload, requestId, ifNoneMatch, StdString(), arena);
+    }
+
+    Private IHttpResponsePtr DispatchInternal(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch, CStdString& acceptEncoding, HttpRequestArena& arena) {
+#if HTTP_METRICS_ENABLED
+        const UInt64 startNs = HttpMetricsNow();
+#endif
+        // Routes match the path only; captures are slices of url, nothing is allocated
+        std::string_view path;
+        HttpQueryString::SplitUrl(url, path);
+        EndpointMatch result = MatchRoute(method, path);
+#if HTTP_METRICS_ENABLED
+        const UInt64 routedNs = HttpMetricsNow();
+        if (metrics != nullptr) {
+            metrics->RecordStage(HttpPipelineStage::Routing, routedNs - startNs);
+        }
+#endif
+        if(result.found == false) {
+#if HTTP_METRICS_ENABLED
+            if (metrics != nullptr) {
+                // Built-in endpoint, only reached when no controller route has this path
+                if (method == HttpMethod::GET && path == HTTP_METRICS_PATH) {
+                    return RenderMetrics(requestId);
+                }
+                metrics->RecordUnmatched();
             }
-            
-            // If response was created without request ID, set it now
-            if (response != nullptr && !requestId.empty() && response->GetRequestId().empty()) {
-                response->SetRequestId(requestId);
+#endif
+            // 405 when the path exists for other methods, 404 otherwise
+            return HttpErrorResponse::Create(result.methodMismatch ? HttpErrorTemplates::MethodNotAllowed : HttpErrorTemplates::NotFound,
+                                             requestId, {url});
+        }
+
+        IHttpResponsePtr response = DispatchMatched(method, url, payload, requestId, ifNoneMatch, acceptEncoding, arena, result);
+#if HTTP_METRICS_ENABLED
+        if (metrics != nullptr) {
+            const UInt64 doneNs = HttpMetricsNow();
+            metrics->RecordStage(HttpPipelineStage::Handler, doneNs - routedNs);
+            metrics->RecordRequest(result.route, response->GetStatusCode(), doneNs - startNs);
+        }
+#endif
+        return response;
+    }
+
+    /**
+     * Literal routes are a single hash and compare; everything else (variables, trailing
+     * slashes, 404/405) is decided by the trie
+     */
+    Private EndpointMatch MatchRoute(HttpMethod method, std::string_view url) const {
+#if HTTP_ROUTE_LITERAL_HASH
+        const HttpRoute* literal = literalRoutes.Find(method, url);
+        if (literal != nullptr) {
+            EndpointMatch match;
+            match.route = literal;
+            match.pattern = literal->pattern;
+            match.found = true;
+            return match;
+        }
+#endif
+        return compiledTrie.Match(url, method);
+    }
+
+    /**
+     * Cache lookup or handler call for a matched route, then compression
+     */
+    Private IHttpResponsePtr DispatchMatched(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch, CStdString& acceptEncoding, HttpRequestArena& arena, const EndpointMatch& result) {
+        // @Cacheable GET routes: a cached response (or 304) is served without calling the controller
+        CBool cacheable = method == HttpMethod::GET && result.route->cacheTtlMs != HttpRouteNotCached && responseCache != nullptr;
+        if (cacheable) {
+            IHttpResponsePtr cached = responseCache->Lookup(url, ifNoneMatch);
+            if (cached != nullptr) {
+                if (!requestId.empty()) {
+                    cached->SetRequestId(requestId);
+                }
+                return Compress(result, url, cached, acceptEncoding);
             }
-            
-            return response;
-    
+        }
+        
+#if HTTP_EXCEPTIONS_ENABLED
+        try {
+            return Compress(result, url, InvokeHandler(result, url, payload, requestId, cacheable, arena), acceptEncoding);
         } catch (const std::exception& e) {
-            // Create proper error response using ResponseEntity (Spring Boot style)
-            StdString errorMessage = StdString(e.what());
-            StdString errorJson = "{\"error\":\"Internal Server Error\",\"message\":\"" + errorMessage + "\"}";
-            ResponseEntity<StdString> errorResponse = ResponseEntity<StdString>::InternalServerError(errorJson);
-            IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(errorResponse);
-            if (response != nullptr && !requestId.empty()) {
-                response->SetRequestId(requestId);
-            }
-            return response;
+            return HttpErrorResponse::Create(HttpErrorTemplates::InternalServerError, requestId, {e.what()});
         } catch (...) {
             // Handle any other exception type (not derived from std::exception)
-            StdString errorJson = "{\"error\":\"Internal Server Error\",\"message\":\"Unknown exception occurred\"}";
-            ResponseEntity<StdString> errorResponse = ResponseEntity<StdString>::InternalServerError(errorJson);
-            IHttpResponsePtr response = ResponseEntityConverter::ToHttpResponse<StdString>(errorResponse);
-            if (response != nullptr && !requestId.empty()) {
-                response->SetRequestId(requestId);
-            }
-            return response;
+            return HttpErrorResponse::Create(HttpErrorTemplates::InternalServerError, requestId, {"Unknown exception occurred"});
         }
-
+#else
+        // Built without exceptions: handlers report errors through their return value
+        // (ResponseEntity / HttpResult status)
+        return Compress(result, url, InvokeHandler(result, url, payload, requestId, cacheable, arena), acceptEncoding);
+#endif
     }
 
-    Private Void InitializeMappings() {
-
+#if HTTP_METRICS_ENABLED
+    Private IHttpResponsePtr RenderMetrics(CStdString& requestId) const {
+        static const StdMap<StdString, StdString> headers{{"Content-Type", "text/plain; version=0.0.4"}};
+        return MakeHttpResponse(requestId, RequestSource::LocalServer, StatusToInt(HttpStatus::OK),
+                                            GetStatusMessage(HttpStatus::OK), headers, metrics->Render());
     }
+#endif
 
-    Private Void InsertMappingsToTrie() {
-        for (const auto& pair : getMappings) {
-            endpointTrie.Insert(pair.first);
-        }
-        for (const auto& pair : postMappings) {
-            endpointTrie.Insert(pair.first);
+    /**
+     * Encode the response for the client unless the route opted out with @NoCompression.
+     * Runs after the cache, which keeps identity bodies; the compressor memoizes the
+     * encoded body per url and ETag, so a cached payload is compressed once, not per hit
+     */
+    Private IHttpResponsePtr Compress(const EndpointMatch& result, CStdString& url, IHttpResponsePtr response, CStdString& acceptEncoding) {
+#if HTTP_RESPONSE_COMPRESSION
+        if (!acceptEncoding.empty() && !result.route->noCompression && responseCompressor != nullptr) {
+            return responseCompressor->Compress(response, acceptEncoding, url);
         }
-        for (const auto& pair : putMappings) {
-            endpointTrie.Insert(pair.first);
+#endif
+        return response;
+    }
+
+    /**
+     * Run the matched route's handler and tag its response (cache, request id)
+     */
+    Private IHttpResponsePtr InvokeHandler(const EndpointMatch& result, CStdString& url, CStdString& payload, CStdString& requestId, CBool cacheable, HttpRequestArena& arena) {
+        // The handler reads body, variables and query parameters through views; nothing is
+        // copied. The cache keeps keying on the whole url, query string included
+        std::string_view path;
+        std::string_view query = HttpQueryString::SplitUrl(url, path);
+        HttpRequestContext context(payload, path, result, arena, query);
+        IHttpResponsePtr response = result.route->handler(context);
+        if (response == nullptr) {
+            return HttpErrorResponse::Create(HttpErrorTemplates::InternalServerError, requestId, {"Handler returned no response"});
         }
-        for (const auto& pair : patchMappings) {
-            endpointTrie.Insert(pair.first);
+        if (cacheable) {
+            response = responseCache->Store(StdString(result.pattern), url, response, result.route->cacheTtlMs);
         }
-        for (const auto& pair : deleteMappings) {
-            endpointTrie.Insert(pair.first);
+        
+        // If response was created without request ID, set it now
+        if (!requestId.empty() && response->GetRequestId().empty()) {
+            response->SetRequestId(requestId);
         }
-        for (const auto& pair : optionsMappings) {
-            endpointTrie.Insert(pair.first);
+        
+        return response;
+    }
+
+    /**
+     * Filled by the pre-build (L6_generate_code_for_all_sources.py) with
+     *   static const IXxxControllerPtr xxxControllerInstance = ...GetInstance();  // singletons only
+     *   static const HttpRoute routes[] = { { HttpMethod::GET, "/url", handler }, ... };
+     *   static const UInt16 literalRouteDisplacements[] = { ... };       // perfect hash of the
+     *   static const HttpRoute* const literalRouteSlots[] = { ... };     // literal routes
+     *   static const LiteralRouteIndex literalRouteIndex{ ... };
+     *   RegisterRoutes(routes, sizeof(routes) / sizeof(routes[0]), literalRouteIndex);
+     * Handlers of singleton controllers use the static instance; prototype controllers
+     * are resolved per request.
+     */
+    Private Void InitializeMappings() {
+
+    }
+
+    /**
+     * Attach a routing table and rebuild the compiled lookup layout. The table must have
+     * static storage duration (or outlive the dispatcher). The node-per-allocation
+     * construction trie only lives for the duration of the call.
+     */
+    Public Void RegisterRoutes(const HttpRoute* table, CSize count) override {
+        AttachRoutes(table, count, nullptr);
+    }
+
+    Public Void RegisterRoutes(const HttpRoute* table, CSize count, const LiteralRouteIndex& literalIndex) override {
+        AttachRoutes(table, count, &literalIndex);
+    }
+
+    Private Void AttachRoutes(const HttpRoute* table, CSize count, const LiteralRouteIndex* literalIndex) {
+        routeTables.emplace_back(table, count);
+
+        EndpointTrie endpointTrie;
+        for (const auto& routeTable : routeTables) {
+            for (Size i = 0; i < routeTable.second; i++) {
+                endpointTrie.Insert(routeTable.first[i]);
+            }
         }
-        for (const auto& pair : headMappings) {
-            endpointTrie.Insert(pair.first);
+        compiledTrie.Compile(endpointTrie);
+
+#if HTTP_ROUTE_LITERAL_HASH
+        // The generated index only covers its own table; later tables may override routes
+        if (literalIndex != nullptr && routeTables.size() == 1) {
+            literalRoutes.Adopt(*literalIndex);
+        } else {
+            literalRoutes.Build(routeTables);
         }
-        for (const auto& pair : traceMappings) {
-            endpointTrie.Insert(pair.first);
+#else
+        (void)literalIndex;
+#endif
+    }
+
+    /**
+     * Build the 400 Bad Request response for a path variable that does not convert to the
+     * handler's parameter type (used by the generated route handlers)
+     *
+     * @param name Path variable name as written in the route pattern
+     * @param value Raw (URL-encoded) value taken from the request path
+     * @return 400 response with a JSON error body
+     */
+    Public Static IHttpResponsePtr InvalidPathVariableResponse(std::string_view name, std::string_view value) {
+        return HttpErrorResponse::Create(HttpErrorTemplates::InvalidPathVariable, StdString(), {name, value});
+    }
+
+    /**
+     * Build the 400 Bad Request response for a required @RequestParam missing from the
+     * query string (used by the generated route handlers)
+     *
+     * @param name Query parameter name as declared on the handler
+     * @return 400 response with a JSON error body
+     */
+    Public Static IHttpResponsePtr MissingRequestParamResponse(std::string_view name) {
+        return HttpErrorResponse::Create(HttpErrorTemplates::MissingRequestParam, StdString(), {name});
+    }
+
+    /**
+     * Build the 400 Bad Request response for a query parameter that does not convert to
+     * the handler's parameter type (used by the generated route handlers)
+     *
+     * @param name Query parameter name as declared on the handler
+     * @param value Raw (URL-encoded) value taken from the query string
+     * @return 400 response with a JSON error body
+     */
+    Public Static IHttpResponsePtr InvalidRequestParamResponse(std::string_view name, std::string_view value) {
+        return HttpErrorResponse::Create(HttpErrorTemplates::InvalidRequestParam, StdString(), {name, value});
+    }
+
+    /**
+     * Hex digit values for URL decoding, 0xFF for characters that are not hex digits
+     */
+    Private Static UInt8 HexValue(Char c) {
+        static constexpr auto table = []() {
+            struct { UInt8 values[256]; } result{};
+            for (Int i = 0; i < 256; i++) {
+                result.values[i] = 0xFF;
+            }
+            for (Int i = 0; i < 10; i++) {
+                result.values['0' + i] = static_cast<UInt8>(i);
+            }
+            for (Int i = 0; i < 6; i++) {
+                result.values['a' + i] = static_cast<UInt8>(10 + i);
+                result.values['A' + i] = static_cast<UInt8>(10 + i);
+            }
+            return result;
+        }();
+        return table.values[static_cast<UInt8>(c)];
+    }
+
+    /**
+     * Position of the first '%' or '+' (the characters UrlDecode() rewrites), or the length
+     * of str when it needs no decoding
+     */
+    Private Static Size FindEncoded(std::string_view str) {
+        Size first = 0;
+        while (first < str.length() && str[first] != '%' && str[first] != '+') {
+            first++;
         }
-        for (const auto& pair : connectMappings) {
-            endpointTrie.Insert(pair.first);
+        return first;
+    }
+
+    /**
+     * Decode str from position first on into out, which already holds str[0, first) and has
+     * room for str.length() characters
+     * 
+     * @return Length of the decoded string
+     */
+    Private Static Size DecodeInto(std::string_view str, Size first, Char* out) {
+        Size length = first;
+        for (Size i = first; i < str.length(); i++) {
+            Char c = str[i];
+            if (c == '%' && i + 2 < str.length()) {
+                UInt8 high = HexValue(str[i + 1]);
+                UInt8 low = HexValue(str[i + 2]);
+                if (high != 0xFF && low != 0xFF) {
+                    out[length++] = static_cast<Char>((high << 4) | low);
+                    i += 2;  // Skip the two hex digits
+                    continue;
+                }
+            } else if (c == '+') {
+                c = ' ';
+            }
+            // Regular character, or an invalid percent encoding kept as-is
+            out[length++] = c;
         }
+        return length;
     }
 
     /**
      * URL decode helper function
-     * Decodes percent-encoded strings (e.g., %20 -> space, %21 -> !)
+     * Decodes percent-encoded strings (e.g., %20 -> space, %21 -> !); + is decoded as space.
+     * Values without '%' or '+' are copied once; otherwise the output is written in place
+     * into a buffer sized for the input.
      * 
      * @param str The URL-encoded string to decode
      * @return The decoded string
      */
-    Private Static StdString UrlDecode(CStdString str) {
-        StdString result;
-        result.reserve(str.length()); // Reserve space for efficiency
-        
-        for (size_t i = 0; i < str.length(); ++i) {
-            if (str[i] == '%' && i + 2 < str.length()) {
-                // Check if we have a valid percent-encoded sequence (%XX)
-                char c1 = str[i + 1];
-                char c2 = str[i + 2];
-                
-                // Check if both characters are hexadecimal digits
-                if (std::isxdigit(c1) && std::isxdigit(c2)) {
-                    // Convert hex digits to integer
-                    int value;
-                    std::istringstream hexStream(StdString(1, c1) + StdString(1, c2));
-                    hexStream >> std::hex >> value;
-                    
-                    // Add the decoded character
-                    result += static_cast<char>(value);
-                    i += 2; // Skip the next two characters (already processed)
-                } else {
-                    // Invalid percent encoding, keep the % as-is
-                    result += str[i];
-                }
-            } else if (str[i] == '+') {
-                // + is often used to represent space in URLs (though more common in query strings)
-                result += ' ';
-            } else {
-                // Regular character, add as-is
-                result += str[i];
-            }
+    Private Static StdString UrlDecode(std::string_view str) {
+        CSize first = FindEncoded(str);
+        StdString result(str);
+        if (first < str.length()) {
+            result.resize(DecodeInto(str, first, &result[0]));
         }
-        
         return result;
-    }   
+    }
+
     /**
-     * Template function to convert a string to a given type.
+     * URL decode into request arena memory
+     * Values without '%' or '+' are returned as is (a slice of the request); otherwise the
+     * decoded copy lives in the arena until the request has been dispatched.
      * 
-     * - If Type is string-related (StdString, CStdString, std::string, string), returns as-is
-     * - If Type is a primitive type (int, Int, long, Long, float, double, bool, etc.), converts from string
+     * @param str The URL-encoded string to decode
+     * @param arena Arena of the request str belongs to
+     * @return The decoded string
+     */
+    Private Static std::string_view UrlDecode(std::string_view str, HttpRequestArena& arena) {
+        CSize first = FindEncoded(str);
+        if (first == str.length()) {
+            return str;
+        }
+        Char* decoded = static_cast<Char*>(arena.Allocate(str.length(), alignof(Char)));
+        std::memcpy(decoded, str.data(), first);
+        return std::string_view(decoded, DecodeInto(str, first, decoded));
+    }
+
+    /**
+     * Case-insensitive comparison of a view against a lowercase literal, without copying
+     */
+    Private Static Bool EqualsLowercase(std::string_view str, std::string_view lowercase) {
+        if (str.length() != lowercase.length()) {
+            return false;
+        }
+        for (Size i = 0; i < str.length(); i++) {
+            Char c = str[i];
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<Char>(c - 'A' + 'a');
+            }
+            if (c != lowercase[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Parse a whole view as a number with std::from_chars (no allocation, no exceptions).
+     * A leading '+' is accepted like std::stoi does; trailing characters are rejected.
+     */
+    Private template<typename Number>
+    Static Bool ParseNumber(std::string_view str, Number& value) {
+        if (!str.empty() && str[0] == '+' && !(str.length() > 1 && str[1] == '-')) {
+            str.remove_prefix(1);
+        }
+        if (str.empty()) {
+            return false;
+        }
+        CChar* end = str.data() + str.length();
+        if constexpr (std::is_floating_point_v<Number>) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            std::from_chars_result parsed = std::from_chars(str.data(), end, value);
+            return parsed.ec == std::errc() && parsed.ptr == end;
+#else
+            // Toolchain without floating point from_chars: strtod on a bounded copy
+            Char digits[64];
+            if (str.length() >= sizeof(digits)) {
+                return false;
+            }
+            std::memcpy(digits, str.data(), str.length());
+            digits[str.length()] = '\0';
+            Char* parsedEnd = nullptr;
+            errno = 0;
+            long double parsed = std::strtold(digits, &parsedEnd);
+            if (parsedEnd != digits + str.length() || errno == ERANGE) {
+                return false;
+            }
+            value = static_cast<Number>(parsed);
+            return true;
+#endif
+        } else {
+            std::from_chars_result parsed = std::from_chars(str.data(), end, value);
+            return parsed.ec == std::errc() && parsed.ptr == end;
+        }
+    }
+
+    /**
+     * Convert a string to a given type without throwing.
+     * 
+     * - If Type is string-related (StdString, CStdString, std::string, string), URL decodes it
+     * - If Type is a primitive type (int, Int, long, Long, float, double, bool, etc.), parses it
      * - Handles types from StandardDefines.h (Int, Long, UInt, ULong, Bool, etc.)
      * 
      * @tparam Type The target type to convert to
-     * @param str The input string to convert
-     * @return The converted value of type Type
+     * @param str The input string to convert (a path variable or query parameter view, or any string)
+     * @param value Receives the converted value
+     * @return false if str is not a valid Type (value is then unspecified)
      */
     Public template<typename Type>
-    Static Type ConvertToType(CStdString str) {
-        // Handle string types - URL decode first, then return
+    Static Bool TryConvertToType(std::string_view str, Type& value) {
+        static_assert(!std::is_const_v<Type>, "TryConvertToType needs a non-const target");
+        
+        // Handle string types - URL decode
         if constexpr (std::is_same_v<Type, StdString> || 
-                      std::is_same_v<Type, CStdString> ||
-                      std::is_same_v<Type, std::string> ||
-                      std::is_same_v<Type, const std::string>) {
+                      std::is_same_v<Type, std::string>) {
             // URL decode the string (e.g., %20 -> space, My%20Name -> My Name)
-            return UrlDecode(str);
+            value = UrlDecode(str);
+            return true;
         }
-        // Handle boolean types (bool, Bool, CBool)
+        // Handle boolean types (bool, Bool)
         else if constexpr (std::is_same_v<Type, bool> || 
-                          std::is_same_v<Type, Bool> || 
-                          std::is_same_v<Type, CBool>) {
-            StdString lower = str;
-            std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-            if (lower == "true" || lower == "1") {
+                          std::is_same_v<Type, Bool>) {
+            if (str == "1" || EqualsLowercase(str, "true")) {
+                value = true;
                 return true;
-            } else if (lower == "false" || lower == "0") {
-                return false;
-            } else {
-                throw std::invalid_argument("Invalid boolean value: " + StdString(str));
             }
-        }
-        // Handle signed integer types (int, Int, CInt, long, Long, CLong, etc.)
-        else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
-            try {
-                if constexpr (sizeof(Type) <= sizeof(int)) {
-                    return static_cast<Type>(std::stoi(str));
-                } else if constexpr (sizeof(Type) <= sizeof(long)) {
-                    return static_cast<Type>(std::stol(str));
-                } else {
-                    return static_cast<Type>(std::stoll(str));
-                }
-            } catch (const std::exception& e) {
-                throw std::invalid_argument("Invalid signed integer value: " + StdString(str));
+            if (str == "0" || EqualsLowercase(str, "false")) {
+                value = false;
+                return true;
             }
+            return false;
         }
-        // Handle unsigned integer types (unsigned int, UInt, CUInt, unsigned long, ULong, CULong, etc.)
-        else if constexpr (std::is_integral_v<Type> && std::is_unsigned_v<Type>) {
-            try {
-                if constexpr (sizeof(Type) <= sizeof(unsigned int)) {
-                    return static_cast<Type>(std::stoul(str));
-                } else if constexpr (sizeof(Type) <= sizeof(unsigned long)) {
-                    return static_cast<Type>(std::stoul(str));
-                } else {
-                    return static_cast<Type>(std::stoull(str));
-                }
-            } catch (const std::exception& e) {
-                throw std::invalid_argument("Invalid unsigned integer value: " + StdString(str));
+        // Handle character types (char, Char, unsigned char, UChar, UInt8)
+        else if constexpr (std::is_same_v<Type, char> || 
+                          std::is_same_v<Type, unsigned char>) {
+            if (str.length() <= 1) {
+                value = str.empty() ? static_cast<Type>(0) : static_cast<Type>(str[0]);
+                return true;
             }
-        }
-        // Handle floating point types (float, double, long double)
-        else if constexpr (std::is_floating_point_v<Type>) {
-            try {
-                if constexpr (std::is_same_v<Type, float>) {
-                    return std::stof(str);
-                } else if constexpr (std::is_same_v<Type, double>) {
-                    return std::stod(str);
-                } else {
-                    return std::stold(str);
-                }
-            } catch (const std::exception& e) {
-                throw std::invalid_argument("Invalid floating point value: " + StdString(str));
+            // Try to parse as integer for character types
+            Int number = 0;
+            if (!ParseNumber(str, number)) {
+                return false;
             }
+            value = static_cast<Type>(number);
+            return true;
         }
-        // Handle character types (char, Char, CChar, unsigned char, UChar, CUChar, UInt8)
-        else if constexpr (std::is_same_v<Type, char> || 
-                          std::is_same_v<Type, Char> || 
-                          std::is_same_v<Type, CChar> ||
-                          std::is_same_v<Type, unsigned char> || 
-                          std::is_same_v<Type, UChar> || 
-                          std::is_same_v<Type, CUChar> ||
-                          std::is_same_v<Type, UInt8>) {
-            if (str.length() == 1) {
-                return static_cast<Type>(str[0]);
-            } else if (str.length() == 0) {
-                return static_cast<Type>(0);
-            } else {
-                // Try to parse as integer for character types
-                try {
-                    return static_cast<Type>(std::stoi(str));
-                } catch (const std::exception& e) {
-                    throw std::invalid_argument("Invalid character value: " + StdString(str));
-                }
-            }
+        // Handle integer and floating point types
+        else if constexpr (std::is_integral_v<Type> || std::is_floating_point_v<Type>) {
+            return ParseNumber(str, value);
         }
         // Fallback: for non-primitive, non-string types, use SerializationUtility::Deserialize
         else {
-            return nayan::serializer::SerializationUtility::Deserialize<Type>(str);
+            value = nayan::serializer::SerializationUtility::Deserialize<Type>(StdString(str));
+            return true;
+        }
+    }
+
+    /**
+     * Convert a path variable or query parameter without throwing, keeping the decoding
+     * temporaries in the request arena (used by the generated route handlers).
+     * 
+     * - std::string_view parameters receive the decoded value without a heap allocation:
+     *   a slice of the request, or a decoded copy in the arena (valid during the handler call)
+     * - StdString parameters are decoded in the arena and copied once into the value
+     * - Every other type converts like TryConvertToType(str, value)
+     * 
+     * @tparam Type The target type to convert to
+     * @param str The input string to convert
+     * @param value Receives the converted value
+     * @param arena Arena of the request str belongs to (HttpRequestContext::GetArena())
+     * @return false if str is not a valid Type (value is then unspecified)
+     */
+    Public template<typename Type>
+    Static Bool TryConvertToType(std::string_view str, Type& value, HttpRequestArena& arena) {
+        static_assert(!std::is_const_v<Type>, "TryConvertToType needs a non-const target");
+        if constexpr (std::is_same_v<Type, std::string_view>) {
+            value = UrlDecode(str, arena);
+            return true;
+        } else if constexpr (std::is_same_v<Type, StdString> ||
+                             std::is_same_v<Type, std::string>) {
+            std::string_view decoded = UrlDecode(str, arena);
+            value.assign(decoded.data(), decoded.length());
+            return true;
+        } else {
+            return TryConvertToType(str, value);
+        }
+    }
+
+    /**
+     * Template function to convert a string to a given type.
+     * Same conversions as TryConvertToType(); throws std::invalid_argument on invalid input
+     * (without exceptions, returns a value-initialized Type instead).
+     * 
+     * @tparam Type The target type to convert to (may be const-qualified)
+     * @param str The input string to convert (a path variable or query parameter view, or any string)
+     * @return The converted value of type Type
+     */
+    Public template<typename Type>
+    Static Type ConvertToType(std::string_view str) {
+        std::remove_cv_t<Type> value{};
+        if (!TryConvertToType(str, value)) {
+#if HTTP_EXCEPTIONS_ENABLED
+            throw std::invalid_argument("Invalid value: " + StdString(str));
+#else
+            return std::remove_cv_t<Type>{};
+#endif
         }
+        return value;
     }
 
 };
@@ -5,9 +5,18 @@
 #include "IHttpRequestQueue.h"
 #include "IHttpRequestProcessor.h"
 #include "IHttpResponseProcessor.h"
+#include "IHttpCloudResponseProcessor.h"
+#include "IHttpResponseQueue.h"
+#include "IHttpPipelineConfig.h"
+#include "IHttpPipelineSignal.h"
+#include "IHttpConnectionTracker.h"
+#include "IHttpLog.h"
+#include "HttpErrorResponse.h"
+#include "HttpPipelineSignal.h"
+#include "HttpPinnedThread.h"
 #include <ServerProvider.h>
 #include <IThreadPool.h>
-#include <ILogger.h>
+#include <atomic>
 
 /* @Component */
 class HttpRequestManager final : public IHttpRequestManager {
@@ -21,71 +30,329 @@ class HttpRequestManager final : public IHttpRequestManager {
     /* @Autowired */
     Private IHttpResponseProcessorPtr responseProcessor;
 
+    /* @Autowired */
+    Private IHttpCloudResponseProcessorPtr cloudResponseProcessor;
+
+    /* @Autowired */
+    Private IHttpResponseQueuePtr responseQueue;
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
+    /* @Autowired */
+    Private IHttpPipelineSignalPtr pipelineSignal;
+
+    /* @Autowired */
+    Private IHttpConnectionTrackerPtr connectionTracker;
+
     /* @Autowired */
     Private IThreadPoolPtr threadPool;
 
     /* @Autowired */
-    Private ILoggerPtr logger;
+    Private IHttpLogPtr httpLog;
 
     Private IServerPtr server;
     Private IServerPtr secondServer;
 
-    Public HttpRequestManager() {
+    // Drain tasks currently submitted to the thread pool
+    Private std::atomic<UInt> activeWorkers;
+
+    // Pinned execution: set while the pinned threads should keep running
+    Private std::atomic<Bool> pinnedRunning;
+    // Pinned threads started and not yet returned
+    Private std::atomic<UInt> pinnedThreads;
+    // The network thread owns the servers; RetrieveRequest leaves them alone
+    Private std::atomic<Bool> networkThreadRunning;
+    // Wakes the dispatch threads; pipelineSignal keeps its single waiter, the loop thread
+    Private HttpPipelineSignal workerSignal;
+
+    Public HttpRequestManager()
+        : activeWorkers(0), pinnedRunning(false), pinnedThreads(0), networkThreadRunning(false) {
         server = ServerProvider::GetDefaultServer();
         secondServer = ServerProvider::GetSecondServer();
     }
     
-    Public ~HttpRequestManager() override = default;
+    Public ~HttpRequestManager() override {
+        // The pinned threads run member functions of this manager; they must be gone
+        // before it is, also when StopServer() was never called
+        if (pinnedRunning.load()) {
+            StopPinnedThreads();
+        }
+    }
 
     // ============================================================================
     // HTTP Request Management Operations
     // ============================================================================
     
-    Private Void RetrieveRequestFromPrimaryServer() {
-        if (server == nullptr) return;
-        IHttpRequestPtr request = server->ReceiveMessage();
+    Private Bool RetrieveRequestFromPrimaryServer() {
+        return RetrieveRequestFrom(server, "primary");
+    }
+
+    Private Bool RetrieveRequestFromSecondaryServer() {
+        return RetrieveRequestFrom(secondServer, "secondary");
+    }
+
+    Private Bool RetrieveRequestFrom(const IServerPtr& source, CChar* serverName) {
+        if (source == nullptr) return false;
+        // Block policy: leave requests inside the server until the queue has room
+        if (config->GetOverflowPolicy() == HttpQueueOverflowPolicy::Block && requestQueue->IsFull()) {
+            return false;
+        }
+        // Any policy: responses are never dropped, so a backed-up sender (slow client or
+        // cloud link) pauses admission until the response queues drain
+        if (responseQueue->IsFull()) {
+            return false;
+        }
+        IHttpRequestPtr request = source->ReceiveMessage();
         if (request != nullptr) {
-            logger->Info(Tag::Untagged, StdString("Received request from primary server"));
-            requestQueue->EnqueueRequest(request);
+            // Per-request trace: compiled out unless HTTP_LOG_LEVEL is DEBUG
+            HTTP_LOG_DEBUG(httpLog, "Received request from %s server", serverName);
+            AdmitRequest(std::move(request));
+            return true;
         }
+        return false;
     }
 
-    Private Void RetrieveRequestFromSecondaryServer() {
-        if (secondServer == nullptr) return;
-        IHttpRequestPtr request = secondServer->ReceiveMessage();
-        if (request != nullptr) {
-            logger->Info(Tag::Untagged, StdString("Received request from secondary server"));
-            requestQueue->EnqueueRequest(request);
+    // The request is moved into the queue, not copied
+    Private Void AdmitRequest(IHttpRequestPtr request) {
+        StdString requestId = StdString(request->GetRequestId());
+        // Arrival order per connection: several pipelined requests may be in flight
+        if (connectionTracker != nullptr) {
+            connectionTracker->OnRequest(requestId, request->GetHeader("Connection"));
+        }
+        switch (config->GetOverflowPolicy()) {
+            case HttpQueueOverflowPolicy::RejectWithServiceUnavailable:
+                // A 503 must not overtake the connection's queued requests: reserve the
+                // response's place before the request can be dequeued
+                if (requestProcessor != nullptr) {
+                    requestProcessor->ReserveResponse(requestId);
+                }
+                if (!requestQueue->TryEnqueueRequest(std::move(request))) {
+                    RejectRequest(requestId);
+                }
+                break;
+            case HttpQueueOverflowPolicy::Block:
+            case HttpQueueOverflowPolicy::DropOldest:
+            default:
+                requestQueue->EnqueueRequest(std::move(request));
+                break;
         }
     }
 
-    Public Bool RetrieveRequest() override {
-        //threadPool->Submit([this]() {
-            RetrieveRequestFromPrimaryServer();
-        //});
+    // Shed load: answer 503 instead of queueing the request, in the reserved place
+    Private Void RejectRequest(CStdString& requestId) {
+        IHttpResponsePtr response = HttpErrorResponse::Create(HttpErrorTemplates::ServiceUnavailable, requestId);
+        if (requestProcessor != nullptr) {
+            requestProcessor->RejectRequest(requestId, std::move(response));
+            return;
+        }
+        responseQueue->EnqueueResponse(std::move(response));
+    }
 
-        //threadPool->Submit([this]() {
-            RetrieveRequestFromSecondaryServer();
-        //});
+    /**
+     * Legacy loop: one request per server, drain the queues, then sleep for a fixed delay.
+     */
+    Private Void RunPollingPass() {
+        RetrieveRequestFromPrimaryServer();
+        RetrieveRequestFromSecondaryServer();
+        ProcessRequest();
+        ProcessResponse();
+        DrainLog();
+        delay(config->GetPollingDelayMs());
+    }
+
+    /**
+     * Event-driven loop: accept up to GetMaxRequestsPerPass() requests from each server,
+     * dispatch them and flush the responses right away. The loop only sleeps when nothing
+     * arrived and the request queue is empty, and the sleep ends early as soon as any
+     * queue is notified, so a burst is served back-to-back instead of one per second.
+     */
+    Private Bool RunEventDrivenPass() {
+        CUInt maxRequests = config->GetMaxRequestsPerPass();
+        UInt received = 0;
+        Bool primaryActive = true;
+        Bool secondaryActive = true;
+        while (received < maxRequests && (primaryActive || secondaryActive)) {
+            if (primaryActive) {
+                primaryActive = RetrieveRequestFromPrimaryServer();
+            }
+            if (secondaryActive) {
+                secondaryActive = RetrieveRequestFromSecondaryServer();
+            }
+            if (primaryActive || secondaryActive) {
+                received++;
+            }
+        }
 
         ProcessRequest();
         ProcessResponse();
-        delay(1000);
+        DrainLog();
+
+        if (received == 0 && requestQueue->IsEmpty() && responseQueue->IsEmpty()) {
+            pipelineSignal->Wait(config->GetIdleWaitMs());
+        }
+        return received > 0;
+    }
+
+    /**
+     * Forward buffered log records to ILogger; runs after the pass's responses went out
+     */
+    Private Void DrainLog() {
+        if (httpLog != nullptr) {
+            httpLog->Drain(HTTP_LOG_DRAIN_BATCH);
+        }
+    }
+
+    Private Bool RunPass() {
+        // Free the keep-alive slots of connections that went quiet
+        if (connectionTracker != nullptr) {
+            connectionTracker->ExpireIdleConnections();
+        }
+
+        if (config->GetLoopMode() == HttpRequestLoopMode::Polling) {
+            RunPollingPass();
+            return true;
+        }
+        return RunEventDrivenPass();
+    }
+
+    Public Bool RetrieveRequest() override {
+        if (networkThreadRunning.load()) {
+            // The pinned network thread runs the passes; keep a caller's loop from spinning
+            delay(config->GetIdleWaitMs());
+            return false;
+        }
+        return RunPass();
+    }
+
+    // ============================================================================
+    // Pinned Execution
+    // ============================================================================
+
+    /**
+     * Network thread body: receive from both servers and send responses, on the core of
+     * the WiFi/network stack. Dispatch happens on the worker threads, connected to this
+     * one by the request and response queues.
+     */
+    Private Void RunNetworkThread() {
+        while (pinnedRunning.load()) {
+            RunPass();
+        }
+        pinnedThreads.fetch_sub(1);
+    }
+
+    /**
+     * Dispatch thread body: drain the request queue, then sleep until the loop reports
+     * new requests. Each enqueued response wakes the loop through the response queue.
+     */
+    Private Void RunPinnedWorker() {
+        while (pinnedRunning.load()) {
+            Bool processedAny = false;
+            while (requestProcessor->ProcessRequest()) {
+                processedAny = true;
+                // The signal wakes one waiter at a time; hand the rest of a burst on
+                if (requestQueue->HasRequests()) {
+                    workerSignal.Notify();
+                }
+            }
+            if (!processedAny) {
+                workerSignal.Wait(config->GetIdleWaitMs());
+            }
+        }
+        pinnedThreads.fetch_sub(1);
+    }
+
+    Private Bool StartPinnedThreads() {
+        CUInt coreCount = HttpPinnedThread::GetCoreCount();
+        CUInt workerCount = config->GetWorkerCount();
+        CUInt workerCore = config->GetWorkerCore();
+        pinnedRunning.store(true);
+        for (UInt i = 0; i < workerCount; i++) {
+            pinnedThreads.fetch_add(1);
+            if (!HttpPinnedThread::Start("http-worker", (workerCore + i) % coreCount, [this]() {
+                    RunPinnedWorker();
+                })) {
+                pinnedThreads.fetch_sub(1);
+                StopPinnedThreads();
+                return false;
+            }
+        }
+        CInt networkCore = config->GetNetworkCore();
+        if (networkCore >= 0) {
+            pinnedThreads.fetch_add(1);
+            networkThreadRunning.store(true);
+            if (!HttpPinnedThread::Start("http-network", static_cast<UInt>(networkCore) % coreCount, [this]() {
+                    RunNetworkThread();
+                })) {
+                pinnedThreads.fetch_sub(1);
+                StopPinnedThreads();
+                return false;
+            }
+        }
+        HTTP_LOG_INFO(httpLog, "Pinned execution: %u dispatch threads from core %u, network core %d",
+                      workerCount, workerCore % coreCount, networkCore);
         return true;
     }
+
+    // Returns once every pinned thread has left its loop
+    Private Void StopPinnedThreads() {
+        pinnedRunning.store(false);
+        while (pinnedThreads.load() > 0) {
+            workerSignal.Notify();
+            pipelineSignal->Notify();
+            delay(1);
+        }
+        networkThreadRunning.store(false);
+    }
     
+    /**
+     * Worker body: dispatch until the request queue runs dry, then wake the loop
+     * so the produced responses are sent without waiting for the idle timeout.
+     */
+    Private Void DrainRequestQueue() {
+        while (requestProcessor->ProcessRequest()) {
+        }
+        activeWorkers.fetch_sub(1);
+        pipelineSignal->Notify();
+    }
+
     Public Bool ProcessRequest() override {
         if (requestProcessor == nullptr) {
             return false;
         }
+
+        if (pinnedRunning.load()) {
+            // The pinned dispatch threads take it from here
+            if (requestQueue->HasRequests()) {
+                workerSignal.Notify();
+                return true;
+            }
+            return false;
+        }
+
+        CUInt workerCount = config->GetWorkerCount();
+        if (workerCount > 1 && threadPool != nullptr) {
+            // Top up the drain tasks; each one keeps pulling until the queue is empty
+            Bool submittedAny = false;
+            while (requestQueue->HasRequests()) {
+                UInt active = activeWorkers.load();
+                if (active >= workerCount) {
+                    break;
+                }
+                if (!activeWorkers.compare_exchange_weak(active, active + 1)) {
+                    continue;
+                }
+                threadPool->Submit([this]() {
+                    DrainRequestQueue();
+                });
+                submittedAny = true;
+            }
+            return submittedAny;
+        }
         
         Bool processedAny = false;
-        while (requestQueue->HasRequests()) {
-            if (requestProcessor->ProcessRequest()) {
-                processedAny = true;
-            } else {
-                break;
-            }
+        while (requestProcessor->ProcessRequest()) {
+            processedAny = true;
         }
         
         return processedAny;
@@ -96,15 +363,24 @@ class HttpRequestManager final : public IHttpRequestManager {
             return false;
         }
         
+        // Send in batches until a batch comes back short, i.e. the queue is drained
+        CSize batchSize = config->GetResponseBatchSize();
         Bool processedAny = false;
-        // Process responses until queue is empty or processor returns false
         while (true) {
-            if (responseProcessor->ProcessResponse()) {
+            Size processed = responseProcessor->ProcessResponses(batchSize);
+            if (processed > 0) {
                 processedAny = true;
-            } else {
+            }
+            if (processed < batchSize) {
                 break;
             }
         }
+
+        // Cloud egress gets one bounded batch per pass so a slow link can't stall local clients
+        if (cloudResponseProcessor != nullptr &&
+            cloudResponseProcessor->ProcessResponses(config->GetCloudResponseBatchSize()) > 0) {
+            processedAny = true;
+        }
         
         return processedAny;
     }
@@ -117,10 +393,19 @@ class HttpRequestManager final : public IHttpRequestManager {
         if (result && secondServer != nullptr) {
             secondServer->Start(port);
         }
+        if (result && config->GetExecutionMode() == HttpExecutionMode::Pinned && !pinnedRunning.load() &&
+            !StartPinnedThreads()) {
+            // Out of memory for a thread: keep serving from the caller's loop
+            HTTP_LOG_WARNING(httpLog, "Pinned threads could not be started, using shared execution");
+        }
         return result;
     }
     
     Public Void StopServer() override {
+        // The pinned threads use the servers; stop them first
+        if (pinnedRunning.load()) {
+            StopPinnedThreads();
+        }
         if (server != nullptr) {
             server->Stop();
         }
@@ -5,7 +5,10 @@
 #include "IHttpRequestQueue.h"
 #include "IHttpRequestDispatcher.h"
 #include "IHttpResponseQueue.h"
+#include "HttpResponseReorderBuffer.h"
+#include "HttpRequestArena.h"
 #include <IHttpResponse.h>
+#include <mutex>
 
 /* @Component */
 class HttpRequestProcessor final : public IHttpRequestProcessor {
@@ -19,6 +22,10 @@ class HttpRequestProcessor final : public IHttpRequestProcessor {
     /* @Autowired */
     Private IHttpResponseQueuePtr responseQueue;
 
+    // Serializes dequeue + ticket reservation so tickets follow queue order across workers
+    Private std::mutex dequeueMutex;
+    Private HttpResponseReorderBuffer reorderBuffer;
+
     Public HttpRequestProcessor() = default;
     
     Public ~HttpRequestProcessor() override = default;
@@ -27,21 +34,45 @@ class HttpRequestProcessor final : public IHttpRequestProcessor {
     // HTTP Request Processing Operations
     // ============================================================================
     
+    // Safe to call from several worker threads at once. Responses of the same requestId
+    // are pushed to the response queue in the order their requests were dequeued.
     Public Bool ProcessRequest() override {
-        if (requestQueue->IsEmpty()) {
-            return false;
-        }
-        
-        IHttpRequestPtr request = requestQueue->DequeueRequest();
-        if (request == nullptr) {
-            return false;
+        IHttpRequestPtr request;
+        StdString requestId;
+        UInt64 ticket = 0;
+        {
+            std::lock_guard<std::mutex> lock(dequeueMutex);
+            if (!requestQueue->TryDequeueRequest(request)) {
+                return false;
+            }
+            requestId = request->GetRequestId();
+            ticket = reorderBuffer.Begin(requestId);
         }
-        
-        // Enqueue response into response queue
-        responseQueue->EnqueueResponse(dispatcher->DispatchRequest(request));
-        
+
+        // Request temporaries come from an arena on this worker's stack and are released
+        // in one shot when the request is done
+        HttpRequestArena arena;
+        IHttpResponsePtr response = dispatcher->DispatchRequest(std::move(request), arena);
+
+        // Enqueue response into response queue, in per-connection order. Ownership moves
+        // along (no reference count traffic); the response slot is recycled once it is sent
+        reorderBuffer.Complete(requestId, ticket, std::move(response), [this](IHttpResponsePtr ready) {
+            responseQueue->EnqueueResponse(std::move(ready));
+        });
+
         return true;
     }
+
+    Public Void ReserveResponse(CStdString& requestId) override {
+        reorderBuffer.Reserve(requestId);
+    }
+
+    Public Void RejectRequest(CStdString& requestId, IHttpResponsePtr response) override {
+        UInt64 ticket = reorderBuffer.Withdraw(requestId);
+        reorderBuffer.Complete(requestId, ticket, std::move(response), [this](IHttpResponsePtr ready) {
+            responseQueue->EnqueueResponse(std::move(ready));
+        });
+    }
 };
 
 #endif // HTTP_REQUEST_PROCESSOR_H
@@ -1,16 +1,32 @@
-#ifndef HTTP_REQUEST_QUEUE_H
+#include "HttpPipelineDefaults.h"
+
+// Mutex-based queue; replaced by LockFreeHttpRequestQueue when HTTP_USE_LOCK_FREE_QUEUES is set
+#if !defined(HTTP_REQUEST_QUEUE_H) && !HTTP_USE_LOCK_FREE_QUEUES
 #define HTTP_REQUEST_QUEUE_H
 
 #include "IHttpRequestQueue.h"
+#include "IHttpPipelineSignal.h"
+#include "IHttpPipelineConfig.h"
 #include <queue>
 #include <mutex>
 
 /* @Component */
 class HttpRequestQueue final : public IHttpRequestQueue {
+
+    /* @Autowired */
+    Private IHttpPipelineSignalPtr pipelineSignal;
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
     Private std::queue<IHttpRequestPtr> requestQueue;
     Private mutable std::mutex queueMutex;
+    Private Size highWaterMark;
+    Private Size droppedCount;
+    Private Size rejectedCount;
 
-    Public HttpRequestQueue() = default;
+    Public HttpRequestQueue() : highWaterMark(0), droppedCount(0), rejectedCount(0) {
+    }
 
     Public ~HttpRequestQueue() override = default;
 
@@ -22,8 +38,32 @@ class HttpRequestQueue final : public IHttpRequestQueue {
         if (request == nullptr) {
             return;
         }
-        std::lock_guard<std::mutex> lock(queueMutex);
-        requestQueue.push(request);
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            CSize capacity = config->GetRequestQueueCapacity();
+            while (!requestQueue.empty() && requestQueue.size() >= capacity) {
+                requestQueue.pop();
+                droppedCount++;
+            }
+            PushLocked(std::move(request));
+        }
+        pipelineSignal->Notify();
+    }
+
+    Public Bool TryEnqueueRequest(IHttpRequestPtr request) override {
+        if (request == nullptr) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (requestQueue.size() >= config->GetRequestQueueCapacity()) {
+                rejectedCount++;
+                return false;
+            }
+            PushLocked(std::move(request));
+        }
+        pipelineSignal->Notify();
+        return true;
     }
 
     Public IHttpRequestPtr DequeueRequest() override {
@@ -31,11 +71,21 @@ class HttpRequestQueue final : public IHttpRequestQueue {
         if (requestQueue.empty()) {
             return nullptr;
         }
-        IHttpRequestPtr request = requestQueue.front();
+        IHttpRequestPtr request = std::move(requestQueue.front());
         requestQueue.pop();
         return request;
     }
 
+    Public Bool TryDequeueRequest(IHttpRequestPtr& out) override {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (requestQueue.empty()) {
+            return false;
+        }
+        out = std::move(requestQueue.front());
+        requestQueue.pop();
+        return true;
+    }
+
     Public Bool IsEmpty() const override {
         std::lock_guard<std::mutex> lock(queueMutex);
         return requestQueue.empty();
@@ -45,7 +95,30 @@ class HttpRequestQueue final : public IHttpRequestQueue {
         std::lock_guard<std::mutex> lock(queueMutex);
         return !requestQueue.empty();
     }
+
+    Public Bool IsFull() const override {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return requestQueue.size() >= config->GetRequestQueueCapacity();
+    }
+
+    Public HttpQueueStats GetStats() const override {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        HttpQueueStats stats;
+        stats.depth = requestQueue.size();
+        stats.capacity = config->GetRequestQueueCapacity();
+        stats.highWaterMark = highWaterMark;
+        stats.dropped = droppedCount;
+        stats.rejected = rejectedCount;
+        return stats;
+    }
+
+    // Caller holds queueMutex
+    Private Void PushLocked(IHttpRequestPtr request) {
+        requestQueue.push(std::move(request));
+        if (requestQueue.size() > highWaterMark) {
+            highWaterMark = requestQueue.size();
+        }
+    }
 };
 
 #endif // HTTP_REQUEST_QUEUE_H
-
@@ -0,0 +1,192 @@
+#ifndef HTTP_RESPONSE_CACHE_H
+#define HTTP_RESPONSE_CACHE_H
+
+#include "IHttpResponseCache.h"
+#include "HttpRoute.h"
+#include "HttpStatus.h"
+#include "HttpPipelineDefaults.h"
+#include <SimpleHttpResponse.h>
+#include "HttpResponsePool.h"
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Serialized responses of @Cacheable GET routes, keyed by request path
+ *
+ * A hit skips the controller call and body serialization; a matching If-None-Match
+ * turns into a bodyless 304. Every cached response carries a strong ETag (FNV-1a of the
+ * body). Thread-safe: request workers may dispatch concurrently.
+ */
+/* @Component */
+class HttpResponseCache final : public IHttpResponseCache {
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        StdString pattern;
+        UInt statusCode;
+        StdString statusMessage;
+        StdMap<StdString, StdString> headers;  // Including ETag
+        StdString body;
+        StdString etag;
+        Bool expires;
+        Clock::time_point expiresAt;
+    };
+
+    Private std::mutex cacheMutex;
+    Private StdMap<StdString, Entry> entries;
+
+    Public HttpResponseCache() = default;
+
+    Public ~HttpResponseCache() override = default;
+
+    // ============================================================================
+    // Response Cache Operations (thread-safe)
+    // ============================================================================
+
+    Public IHttpResponsePtr Lookup(CStdString& path, CStdString& ifNoneMatch) override {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = entries.find(path);
+        if (it == entries.end()) {
+            return nullptr;
+        }
+        const Entry& entry = it->second;
+        if (entry.expires && Clock::now() >= entry.expiresAt) {
+            entries.erase(it);
+            return nullptr;
+        }
+
+        if (!ifNoneMatch.empty() && EtagMatches(ifNoneMatch, entry.etag)) {
+            StdMap<StdString, StdString> headers{{"ETag", entry.etag}};
+            return MakeHttpResponse(StdString(), RequestSource::LocalServer,
+                StatusToInt(HttpStatus::NOT_MODIFIED), GetStatusMessage(HttpStatus::NOT_MODIFIED), headers, StdString());
+        }
+        return MakeHttpResponse(StdString(), RequestSource::LocalServer,
+            entry.statusCode, entry.statusMessage, entry.headers, entry.body);
+    }
+
+    Public IHttpResponsePtr Store(CStdString& pattern, CStdString& path, IHttpResponsePtr response, CUInt ttlMs) override {
+        if (response == nullptr || ttlMs == HttpRouteNotCached ||
+            response->GetStatusCode() != StatusToInt(HttpStatus::OK) ||
+            response->GetBody().length() > HTTP_RESPONSE_CACHE_MAX_BODY_BYTES) {
+            return response;
+        }
+
+        Entry entry;
+        entry.pattern = pattern;
+        entry.statusCode = response->GetStatusCode();
+        entry.statusMessage = response->GetStatusMessage();
+        entry.headers = response->GetHeaders();
+        entry.body = response->GetBody();
+        entry.etag = ComputeEtag(entry.body);
+        entry.headers["ETag"] = entry.etag;
+        entry.expires = ttlMs != HttpRouteCacheUntilInvalidated;
+        entry.expiresAt = Clock::now() + std::chrono::milliseconds(ttlMs);
+
+        IHttpResponsePtr tagged = MakeHttpResponse(response->GetRequestId(), response->GetRequestSource(),
+            entry.statusCode, entry.statusMessage, entry.headers, entry.body);
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (entries.find(path) == entries.end() && entries.size() >= HTTP_RESPONSE_CACHE_MAX_ENTRIES) {
+            EvictOne();
+        }
+        entries[path] = std::move(entry);
+        return tagged;
+    }
+
+    Public Void Invalidate(CStdString& path) override {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        entries.erase(path);
+    }
+
+    Public Void InvalidatePattern(CStdString& pattern) override {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->second.pattern == pattern) {
+                it = entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    Public Void InvalidateAll() override {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        entries.clear();
+    }
+
+    Public Size GetEntryCount() override {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        return entries.size();
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    /**
+     * Strong ETag of a body: quoted 64-bit FNV-1a hash in hex
+     */
+    Private Static StdString ComputeEtag(CStdString& body) {
+        UInt64 hash = 14695981039346656037ULL;
+        for (Char c : body) {
+            hash ^= static_cast<UInt8>(c);
+            hash *= 1099511628211ULL;
+        }
+        Char etag[24];
+        snprintf(etag, sizeof(etag), "\"%016llx\"", static_cast<unsigned long long>(hash));
+        return StdString(etag);
+    }
+
+    /**
+     * If-None-Match is "*" or a comma-separated list of (possibly weak) entity tags
+     */
+    Private Static Bool EtagMatches(CStdString& ifNoneMatch, CStdString& etag) {
+        Size begin = 0;
+        while (begin < ifNoneMatch.length()) {
+            Size end = ifNoneMatch.find(',', begin);
+            if (end == StdString::npos) {
+                end = ifNoneMatch.length();
+            }
+            Size first = ifNoneMatch.find_first_not_of(" \t", begin);
+            Size last = ifNoneMatch.find_last_not_of(" \t", end - 1);
+            if (first != StdString::npos && first < end && last >= first) {
+                if (ifNoneMatch.compare(first, 2, "W/") == 0) {
+                    first += 2;
+                }
+                Size length = last + 1 - first;
+                if ((length == 1 && ifNoneMatch[first] == '*') ||
+                    ifNoneMatch.compare(first, length, etag) == 0) {
+                    return true;
+                }
+            }
+            begin = end + 1;
+        }
+        return false;
+    }
+
+    /**
+     * Make room for one entry: drop expired entries, else the one expiring soonest
+     * (entries kept until invalidated go last). Caller holds cacheMutex.
+     */
+    Private Void EvictOne() {
+        Clock::time_point now = Clock::now();
+        auto victim = entries.end();
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->second.expires && now >= it->second.expiresAt) {
+                it = entries.erase(it);
+                continue;
+            }
+            if (victim == entries.end() ||
+                (it->second.expires && (!victim->second.expires || it->second.expiresAt < victim->second.expiresAt))) {
+                victim = it;
+            }
+            ++it;
+        }
+        if (entries.size() >= HTTP_RESPONSE_CACHE_MAX_ENTRIES && victim != entries.end()) {
+            entries.erase(victim);
+        }
+    }
+};
+
+#endif // HTTP_RESPONSE_CACHE_H
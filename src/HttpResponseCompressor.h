@@ -0,0 +1,241 @@
+#ifndef HTTP_RESPONSE_COMPRESSOR_H
+#define HTTP_RESPONSE_COMPRESSOR_H
+
+#include "IHttpResponseCompressor.h"
+#include "HttpDeflate.h"
+#include "HttpPipelineDefaults.h"
+#include <SimpleHttpResponse.h>
+#include "HttpResponsePool.h"
+#include <mutex>
+#include <cstdlib>
+#include <string_view>
+
+/**
+ * Compression stage applied by the dispatcher to handler and cached responses
+ *
+ * Responses carrying an ETag (those of @Cacheable routes) are compressed once per coding:
+ * the encoded body is remembered under the request url and ETag, and reused on later hits
+ * whose identity body still has the remembered length. The encoded
+ * variant gets a weak ETag, so If-None-Match revalidation still yields 304. Thread-safe:
+ * workers share one encoder under a lock.
+ */
+/* @Component */
+class HttpResponseCompressor final : public IHttpResponseCompressor {
+    struct MemoEntry {
+        StdString resource;
+        StdString etag;
+        HttpContentEncoding encoding;
+        Size identityLength;
+        StdString body;
+        UInt64 lastUse;
+    };
+
+    Private std::mutex compressorMutex;
+    Private HttpDeflate deflate;
+    Private StdVector<MemoEntry> memo;
+    Private UInt64 useCounter;
+
+    Public HttpResponseCompressor() : useCounter(0) {
+    }
+
+    Public ~HttpResponseCompressor() override = default;
+
+    // ============================================================================
+    // Response Compression Operations (thread-safe)
+    // ============================================================================
+
+    Public IHttpResponsePtr Compress(IHttpResponsePtr response, CStdString& acceptEncoding, CStdString& resource) override {
+        if (response == nullptr || response->GetBody().length() < HTTP_COMPRESSION_MIN_BYTES) {
+            return response;
+        }
+        HttpContentEncoding encoding = NegotiateEncoding(acceptEncoding);
+        if (encoding == HttpContentEncoding::Identity) {
+            return response;
+        }
+
+        const StdMap<StdString, StdString>& headers = response->GetHeaders();
+        CStdString* etag = nullptr;
+        for (const auto& header : headers) {
+            if (EqualsLowercase(header.first, "content-encoding")) {
+                return response;  // Already encoded by the handler
+            }
+            if (EqualsLowercase(header.first, "etag")) {
+                etag = &header.second;
+            }
+        }
+
+        StdString body;
+        {
+            std::lock_guard<std::mutex> lock(compressorMutex);
+            if (etag == nullptr || !FindMemo(resource, *etag, encoding, response->GetBody().length(), body)) {
+                deflate.Compress(response->GetBody(), encoding, body);
+                if (body.length() >= response->GetBody().length()) {
+                    return response;  // Incompressible (already compressed data, random bytes)
+                }
+                if (etag != nullptr) {
+                    Remember(resource, *etag, encoding, response->GetBody().length(), body);
+                }
+            }
+        }
+
+        StdMap<StdString, StdString> encodedHeaders = headers;
+        encodedHeaders["Content-Encoding"] = ContentEncodingName(encoding);
+        encodedHeaders["Vary"] = "Accept-Encoding";
+        if (etag != nullptr && etag->compare(0, 2, "W/") != 0) {
+            // Byte-different representation: only weakly equivalent to the identity one
+            encodedHeaders[EtagHeaderName(headers)] = "W/" + *etag;
+        }
+        return MakeHttpResponse(response->GetRequestId(), response->GetRequestSource(),
+            response->GetStatusCode(), response->GetStatusMessage(), encodedHeaders, std::move(body));
+    }
+
+    /**
+     * @brief Pick the coding for an Accept-Encoding value: gzip, then deflate; codings with
+     *        q=0 are refused, "*" accepts gzip
+     */
+    Public Static HttpContentEncoding NegotiateEncoding(std::string_view acceptEncoding) {
+        Bool gzip = false;
+        Bool deflateAccepted = false;
+        Bool wildcard = false;
+        Bool gzipRefused = false;
+        Size begin = 0;
+        while (begin < acceptEncoding.length()) {
+            Size end = acceptEncoding.find(',', begin);
+            if (end == std::string_view::npos) {
+                end = acceptEncoding.length();
+            }
+            std::string_view item = Trim(acceptEncoding.substr(begin, end - begin));
+            std::string_view coding = item;
+            Bool refused = false;
+            Size parameters = item.find(';');
+            if (parameters != std::string_view::npos) {
+                coding = Trim(item.substr(0, parameters));
+                refused = IsZeroQuality(item.substr(parameters + 1));
+            }
+            if (EqualsLowercase(coding, "gzip") || EqualsLowercase(coding, "x-gzip")) {
+                gzip = !refused;
+                gzipRefused = refused;
+            } else if (EqualsLowercase(coding, "deflate")) {
+                deflateAccepted = !refused;
+            } else if (coding == "*") {
+                wildcard = !refused;
+            }
+            begin = end + 1;
+        }
+        if (gzip || (wildcard && !gzipRefused)) {
+            return HttpContentEncoding::Gzip;
+        }
+        return deflateAccepted ? HttpContentEncoding::Deflate : HttpContentEncoding::Identity;
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    Private Static std::string_view Trim(std::string_view value) {
+        while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+            value.remove_prefix(1);
+        }
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+            value.remove_suffix(1);
+        }
+        return value;
+    }
+
+    /**
+     * "q=0", "q=0.0", "q=0.000" (possibly among other parameters) refuse a coding
+     */
+    Private Static Bool IsZeroQuality(std::string_view parameters) {
+        Size position = 0;
+        while (position < parameters.length()) {
+            Size end = parameters.find(';', position);
+            if (end == std::string_view::npos) {
+                end = parameters.length();
+            }
+            std::string_view parameter = Trim(parameters.substr(position, end - position));
+            if (parameter.length() >= 3 && (parameter[0] == 'q' || parameter[0] == 'Q') && parameter[1] == '=') {
+                std::string_view value = parameter.substr(2);
+                if (value.empty() || value[0] != '0') {
+                    return false;
+                }
+                for (Size i = 1; i < value.length(); i++) {
+                    if (value[i] != '.' && value[i] != '0') {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            position = end + 1;
+        }
+        return false;
+    }
+
+    Private Static Bool EqualsLowercase(std::string_view str, std::string_view lowercase) {
+        if (str.length() != lowercase.length()) {
+            return false;
+        }
+        for (Size i = 0; i < str.length(); i++) {
+            Char c = str[i];
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<Char>(c - 'A' + 'a');
+            }
+            if (c != lowercase[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Spelling of the response's ETag header, so the weak tag replaces it instead of adding
+     * a second one
+     */
+    Private Static StdString EtagHeaderName(const StdMap<StdString, StdString>& headers) {
+        for (const auto& header : headers) {
+            if (EqualsLowercase(header.first, "etag")) {
+                return header.first;
+            }
+        }
+        return "ETag";
+    }
+
+    /**
+     * An entry only answers for the same resource and ETag, and for an identity body of the
+     * length it was encoded from (guards against a handler reusing an ETag for new content).
+     * Caller holds compressorMutex
+     */
+    Private Bool FindMemo(CStdString& resource, CStdString& etag, HttpContentEncoding encoding, CSize identityLength, StdString& body) {
+        for (MemoEntry& entry : memo) {
+            if (entry.encoding == encoding && entry.identityLength == identityLength
+                && entry.etag == etag && entry.resource == resource) {
+                entry.lastUse = ++useCounter;
+                body = entry.body;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Keep an encoded body, replacing the least recently used one when full. Caller holds
+     * compressorMutex
+     */
+    Private Void Remember(CStdString& resource, CStdString& etag, HttpContentEncoding encoding, CSize identityLength, CStdString& body) {
+        if (HTTP_COMPRESSION_MEMO_ENTRIES == 0) {
+            return;
+        }
+        if (memo.size() < HTTP_COMPRESSION_MEMO_ENTRIES) {
+            memo.push_back(MemoEntry{resource, etag, encoding, identityLength, body, ++useCounter});
+            return;
+        }
+        MemoEntry* victim = &memo[0];
+        for (MemoEntry& entry : memo) {
+            if (entry.lastUse < victim->lastUse) {
+                victim = &entry;
+            }
+        }
+        *victim = MemoEntry{resource, etag, encoding, identityLength, body, ++useCounter};
+    }
+};
+
+#endif // HTTP_RESPONSE_COMPRESSOR_H
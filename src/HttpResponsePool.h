@@ -0,0 +1,167 @@
+#ifndef HTTP_RESPONSE_POOL_H
+#define HTTP_RESPONSE_POOL_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+#include <SimpleHttpResponse.h>
+#include "HttpPipelineDefaults.h"
+#include "MpmcRingBuffer.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * Preallocated slots for the responses in flight
+ *
+ * A response is created per request and released once the response processor has sent
+ * it. With HTTP_RESPONSE_POOL, MakeHttpResponse() places the response and its reference
+ * count in one of HTTP_RESPONSE_POOL_SLOTS fixed slots (std::allocate_shared), and the
+ * slot goes back to the free list when the last reference drops, i.e. after SendMessage.
+ * Steady-state traffic then does no heap allocation for response objects, and the slots
+ * never fragment the heap.
+ *
+ * The free list is an MpmcRingBuffer of slot indices, so workers allocate and the
+ * response processor releases without a lock. When every slot is in flight (or an
+ * allocation does not fit a slot) the response falls back to the heap; GetFallbackCount()
+ * says when HTTP_RESPONSE_POOL_SLOTS is too small.
+ */
+class HttpResponsePool {
+    Private
+        // The response plus the allocate_shared control block (vtable, two counts, allocator)
+        static constexpr Size SlotBytes =
+            (sizeof(SimpleHttpResponse) + 4 * sizeof(Void*) + alignof(std::max_align_t) - 1) &
+            ~(alignof(std::max_align_t) - 1);
+
+        struct alignas(std::max_align_t) Slot {
+            UInt8 bytes[SlotBytes];
+        };
+
+        Slot* slots;
+        Size slotCount;
+        MpmcRingBuffer<UInt32> freeSlots;
+        std::atomic<Size> fallbackCount;
+
+    Public
+        explicit HttpResponsePool(CSize slotCount)
+            : slots(new Slot[slotCount]), slotCount(slotCount), freeSlots(slotCount), fallbackCount(0) {
+            for (Size i = 0; i < slotCount; i++) {
+                freeSlots.TryPush(static_cast<UInt32>(i));
+            }
+        }
+
+        ~HttpResponsePool() {
+            delete[] slots;
+        }
+
+        HttpResponsePool(const HttpResponsePool&) = delete;
+        HttpResponsePool& operator=(const HttpResponsePool&) = delete;
+
+        /**
+         * @brief Pool shared by all response producers. Never destroyed: responses held by
+         *        static objects may be released after the end of main()
+         */
+        Static HttpResponsePool& Shared() {
+            static HttpResponsePool* pool = new HttpResponsePool(HTTP_RESPONSE_POOL_SLOTS);
+            return *pool;
+        }
+
+        /**
+         * @brief A free slot when bytes fits one, heap memory otherwise
+         */
+        Void* Allocate(CSize bytes) {
+            UInt32 index = 0;
+            if (bytes <= SlotBytes && freeSlots.TryPop(index)) {
+                return slots[index].bytes;
+            }
+            fallbackCount.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(bytes);
+        }
+
+        /**
+         * @brief Return memory obtained from Allocate()
+         */
+        Void Release(Void* pointer) noexcept {
+            Slot* slot = static_cast<Slot*>(pointer);
+            if (slot >= slots && slot < slots + slotCount) {
+                freeSlots.TryPush(static_cast<UInt32>(slot - slots));
+                return;
+            }
+            ::operator delete(pointer);
+        }
+
+        Size GetCapacity() const {
+            return slotCount;
+        }
+
+        /**
+         * @brief Slots currently free (approximate while other threads allocate)
+         */
+        Size GetFreeCount() const {
+            return freeSlots.ApproximateSize();
+        }
+
+        /**
+         * @brief Allocations served by the heap because the pool was exhausted
+         */
+        Size GetFallbackCount() const {
+            return fallbackCount.load(std::memory_order_relaxed);
+        }
+};
+
+/**
+ * Standard allocator over an HttpResponsePool, for std::allocate_shared
+ */
+template<typename T>
+class HttpPoolAllocator {
+    Private HttpResponsePool* pool;
+
+    template<typename U>
+    friend class HttpPoolAllocator;
+
+    Public using value_type = T;
+
+    Public explicit HttpPoolAllocator(HttpResponsePool& pool) noexcept
+        : pool(&pool) {
+    }
+
+    Public template<typename U>
+    HttpPoolAllocator(const HttpPoolAllocator<U>& other) noexcept
+        : pool(other.pool) {
+    }
+
+    Public T* allocate(CSize count) {
+        return static_cast<T*>(pool->Allocate(count * sizeof(T)));
+    }
+
+    Public Void deallocate(T* pointer, Size) noexcept {
+        pool->Release(pointer);
+    }
+
+    Public template<typename U>
+    Bool operator==(const HttpPoolAllocator<U>& other) const noexcept {
+        return pool == other.pool;
+    }
+
+    Public template<typename U>
+    Bool operator!=(const HttpPoolAllocator<U>& other) const noexcept {
+        return pool != other.pool;
+    }
+};
+
+/**
+ * Create a response for the request being handled: in a pooled slot with
+ * HTTP_RESPONSE_POOL, on the heap otherwise. Same arguments as SimpleHttpResponse.
+ */
+template<typename... Args>
+inline IHttpResponsePtr MakeHttpResponse(Args&&... args) {
+#if HTTP_RESPONSE_POOL
+    return std::allocate_shared<SimpleHttpResponse>(HttpPoolAllocator<SimpleHttpResponse>(HttpResponsePool::Shared()),
+                                                    std::forward<Args>(args)...);
+#else
+    return make_ptr<SimpleHttpResponse>(std::forward<Args>(args)...);
+#endif
+}
+
+#endif // HTTP_RESPONSE_POOL_H
@@ -3,8 +3,11 @@
 
 #include "IHttpResponseProcessor.h"
 #include "IHttpResponseQueue.h"
+#include "IHttpConnectionTracker.h"
 #include <ServerProvider.h>
 #include <IHttpResponse.h>
+#include "HttpResponseWriter.h"
+#include "IHttpMetrics.h"
 
 /* @Component */
 class HttpResponseProcessor final : public IHttpResponseProcessor {
@@ -12,8 +15,23 @@ class HttpResponseProcessor final : public IHttpResponseProcessor {
     /* @Autowired */
     Private IHttpResponseQueuePtr responseQueue;
 
+    /* @Autowired */
+    Private IHttpConnectionTrackerPtr connectionTracker;
+
+#if HTTP_METRICS_ENABLED
+    /* @Autowired */
+    Private IHttpMetricsPtr metrics;
+#endif
+
     Private IServerPtr server;
 
+    // Reused between calls so steady-state batching does not allocate; the processor
+    // is driven by the request loop thread only
+    Private StdVector<IHttpResponsePtr> batch;
+
+    // Renders each response into one reused buffer (HTTP_RESPONSE_DIRECT_WRITE)
+    Private HttpResponseWriter writer;
+
     Public HttpResponseProcessor() 
         : server(ServerProvider::GetSecondServer()) {
     }
@@ -25,36 +43,72 @@ class HttpResponseProcessor final : public IHttpResponseProcessor {
     // ============================================================================
     
     Public Bool ProcessResponse() override {
-        if (responseQueue->IsEmpty()) {
-            return false;
-        }
-        
-        IHttpResponsePtr response = responseQueue->DequeueLocalResponse();
-        if (response == nullptr) {
-            return false;
+        return ProcessResponses(1) > 0;
+    }
+
+    Public Size ProcessResponses(CSize maxCount) override {
+        batch.clear();
+        Size taken = responseQueue->DequeueLocalResponses(batch, maxCount);
+
+        for (IHttpResponsePtr& response : batch) {
+            SendResponse(response);
         }
-        
-        if (server == nullptr) {
-            return false;
+
+        // Drop references now instead of holding them until the next batch
+        batch.clear();
+        return taken;
+    }
+
+    Private Void SendResponse(const IHttpResponsePtr& response) {
+        if (server == nullptr || response == nullptr) {
+            return;
         }
-        
+
         // Get request ID from response
         StdString requestId = StdString(response->GetRequestId());
         if (requestId.empty() || requestId == "ignore") {
-            return false;
+            return;
+        }
+
+#if HTTP_METRICS_ENABLED
+        const UInt64 startNs = HttpMetricsNow();
+#endif
+        // Convert response to HTTP string format; responses leave in per-connection order,
+        // so the keep-alive decision is taken here
+#if HTTP_RESPONSE_DIRECT_WRITE
+        CStdString connectionHeaders = connectionTracker != nullptr ? connectionTracker->OnResponse(requestId) : StdString();
+        CStdString& responseString = writer.Write(*response, connectionHeaders);
+#else
+        if (connectionTracker != nullptr) {
+            connectionTracker->OnResponse(requestId);  // Keep the bookkeeping; ToHttpString() sets the headers
         }
-        
-        // Convert response to HTTP string format
         StdString responseString = response->ToHttpString();
         if (responseString.empty()) {
-            return false;
+            return;
         }
-        
+#endif
+
+#if HTTP_METRICS_ENABLED
+        const UInt64 renderedNs = HttpMetricsNow();
+#endif
         // Send response using server
         server->SendMessage(requestId, responseString);
-        return false;
+#if HTTP_METRICS_ENABLED
+        RecordStages(startNs, renderedNs);
+#endif
+#if HTTP_RESPONSE_DIRECT_WRITE
+        writer.Reset();
+#endif
     }
+
+#if HTTP_METRICS_ENABLED
+    Private Void RecordStages(UInt64 startNs, UInt64 renderedNs) {
+        if (metrics != nullptr) {
+            metrics->RecordStage(HttpPipelineStage::Serialization, renderedNs - startNs);
+            metrics->RecordStage(HttpPipelineStage::Send, HttpMetricsNow() - renderedNs);
+        }
+    }
+#endif
 };
 
 #endif // HTTP_RESPONSE_PROCESSOR_H
-
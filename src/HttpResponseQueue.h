@@ -1,16 +1,33 @@
-#ifndef HTTP_RESPONSE_QUEUE_H
+#include "HttpPipelineDefaults.h"
+
+// Mutex-based queue; replaced by LockFreeHttpResponseQueue when HTTP_USE_LOCK_FREE_QUEUES is set
+#if !defined(HTTP_RESPONSE_QUEUE_H) && !HTTP_USE_LOCK_FREE_QUEUES
 #define HTTP_RESPONSE_QUEUE_H
 
 #include "IHttpResponseQueue.h"
+#include "IHttpPipelineSignal.h"
+#include "IHttpPipelineConfig.h"
 #include <queue>
 #include <mutex>
 
 /* @Component */
 class HttpResponseQueue final : public IHttpResponseQueue {
-    Private std::queue<IHttpResponsePtr> localQueue_;
-    Private mutable std::mutex localMutex_;
-    Private std::queue<IHttpResponsePtr> cloudQueue_;
-    Private mutable std::mutex cloudMutex_;
+
+    /* @Autowired */
+    Private IHttpPipelineSignalPtr pipelineSignal;
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
+    // One FIFO; guarded by its own mutex. Its capacity is enforced by admission
+    Private struct BoundedQueue {
+        std::queue<IHttpResponsePtr> items;
+        mutable std::mutex mutex;
+        Size highWaterMark = 0;
+    };
+
+    Private BoundedQueue local_;
+    Private BoundedQueue cloud_;
 
     Public HttpResponseQueue() = default;
 
@@ -24,39 +41,120 @@ class HttpResponseQueue final : public IHttpResponseQueue {
         if (response == nullptr) return;
         RequestSource source = response->GetRequestSource();
         if (source == RequestSource::LocalServer) {
-            std::lock_guard<std::mutex> lock(localMutex_);
-            localQueue_.push(std::move(response));
+            Push(local_, std::move(response));
         } else if (source == RequestSource::CloudServer) {
-            std::lock_guard<std::mutex> lock(cloudMutex_);
-            cloudQueue_.push(std::move(response));
+            // A slow cloud link pauses admission (IsFull()) instead of losing responses
+            Push(cloud_, std::move(response));
+        } else {
+            return;
         }
+        pipelineSignal->Notify();
     }
 
     Public IHttpResponsePtr DequeueLocalResponse() override {
-        std::lock_guard<std::mutex> lock(localMutex_);
-        if (localQueue_.empty()) return nullptr;
-        IHttpResponsePtr r = localQueue_.front();
-        localQueue_.pop();
+        IHttpResponsePtr r;
+        Pop(local_, r);
         return r;
     }
 
     Public IHttpResponsePtr DequeueCloudResponse() override {
-        std::lock_guard<std::mutex> lock(cloudMutex_);
-        if (cloudQueue_.empty()) return nullptr;
-        IHttpResponsePtr r = cloudQueue_.front();
-        cloudQueue_.pop();
+        IHttpResponsePtr r;
+        Pop(cloud_, r);
         return r;
     }
 
+    Public Bool TryDequeueLocalResponse(IHttpResponsePtr& out) override {
+        return Pop(local_, out);
+    }
+
+    Public Bool TryDequeueCloudResponse(IHttpResponsePtr& out) override {
+        return Pop(cloud_, out);
+    }
+
+    Public Size DequeueLocalResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) override {
+        return PopBatch(local_, out, maxCount);
+    }
+
+    Public Size DequeueCloudResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) override {
+        return PopBatch(cloud_, out, maxCount);
+    }
+
+    Public HttpQueueStats GetLocalStats() const override {
+        return Snapshot(local_, GetLocalCapacity());
+    }
+
+    Public HttpQueueStats GetCloudStats() const override {
+        return Snapshot(cloud_, GetCloudCapacity());
+    }
+
     Public Bool IsEmpty() const override {
-        std::lock_guard<std::mutex> lockLocal(localMutex_);
-        std::lock_guard<std::mutex> lockCloud(cloudMutex_);
-        return localQueue_.empty() && cloudQueue_.empty();
+        std::lock_guard<std::mutex> lockLocal(local_.mutex);
+        std::lock_guard<std::mutex> lockCloud(cloud_.mutex);
+        return local_.items.empty() && cloud_.items.empty();
     }
 
     Public Bool HasResponses() const override {
         return !IsEmpty();
     }
+
+    Public Bool IsFull() const override {
+        return Depth(local_) >= GetLocalCapacity() || Depth(cloud_) >= GetCloudCapacity();
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    Private Size GetLocalCapacity() const {
+        return config->GetResponseQueueCapacity();
+    }
+
+    Private Size GetCloudCapacity() const {
+        CSize capacity = config->GetResponseQueueCapacity();
+        CSize highWater = config->GetCloudResponseHighWaterMark();
+        return highWater < capacity ? highWater : capacity;
+    }
+
+    Private Static Size Depth(const BoundedQueue& queue) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        return queue.items.size();
+    }
+
+    Private Static Void Push(BoundedQueue& queue, IHttpResponsePtr response) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.items.push(std::move(response));
+        if (queue.items.size() > queue.highWaterMark) {
+            queue.highWaterMark = queue.items.size();
+        }
+    }
+
+    Private Static Bool Pop(BoundedQueue& queue, IHttpResponsePtr& out) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.items.empty()) return false;
+        out = std::move(queue.items.front());
+        queue.items.pop();
+        return true;
+    }
+
+    Private Static Size PopBatch(BoundedQueue& queue, StdVector<IHttpResponsePtr>& out, CSize maxCount) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        Size taken = 0;
+        while (taken < maxCount && !queue.items.empty()) {
+            out.push_back(std::move(queue.items.front()));
+            queue.items.pop();
+            taken++;
+        }
+        return taken;
+    }
+
+    Private Static HttpQueueStats Snapshot(const BoundedQueue& queue, CSize capacity) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        HttpQueueStats stats;
+        stats.depth = queue.items.size();
+        stats.capacity = capacity;
+        stats.highWaterMark = queue.highWaterMark;
+        return stats;
+    }
 };
 
 #endif // HTTP_RESPONSE_QUEUE_H
@@ -0,0 +1,136 @@
+#ifndef HTTP_RESPONSE_REORDER_BUFFER_H
+#define HTTP_RESPONSE_REORDER_BUFFER_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+#include <deque>
+#include <map>
+#include <mutex>
+
+/**
+ * Keeps responses of the same requestId (connection) in request order when several
+ * workers dispatch concurrently.
+ *
+ * Usage:
+ *   UInt64 ticket = buffer.Begin(requestId);          // in dequeue order
+ *   ... dispatch, possibly on another thread ...
+ *   buffer.Complete(requestId, ticket, response, sink); // sink called in ticket order
+ *
+ * Responses that finish ahead of an earlier request on the same connection are parked
+ * until that request completes. Different requestIds never wait for each other.
+ *
+ * A request answered at admission (e.g. rejected with 503) must still follow the
+ * connection's queued requests. For that, tickets are reserved when requests are
+ * admitted: Reserve() hands out the ticket, Begin() claims the oldest reservation of the
+ * connection at dequeue, and Withdraw() takes back the reservation of a request that
+ * never made it into the queue so it can be completed right away.
+ */
+class HttpResponseReorderBuffer {
+    Private
+        struct ConnectionState {
+            UInt64 nextTicket = 0;   // ticket handed to the next Begin()
+            UInt64 nextRelease = 0;  // ticket whose response goes out next
+            std::deque<UInt64> reserved;  // reserved at admission, not claimed by Begin() yet
+            StdMap<UInt64, IHttpResponsePtr> parked;  // completed, waiting for earlier tickets
+        };
+
+        StdMap<StdString, ConnectionState> connections;
+        std::mutex bufferMutex;
+
+    Public
+        HttpResponseReorderBuffer() = default;
+
+        /**
+         * Ticket for a dequeued request: the connection's oldest reservation, or the next
+         * ticket if there is none
+         */
+        UInt64 Begin(const StdString& requestId) {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            ConnectionState& state = connections[requestId];
+            if (!state.reserved.empty()) {
+                UInt64 ticket = state.reserved.front();
+                state.reserved.pop_front();
+                return ticket;
+            }
+            return state.nextTicket++;
+        }
+
+        /**
+         * Reserve the next ticket at admission, before the request can be dequeued
+         */
+        UInt64 Reserve(const StdString& requestId) {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            ConnectionState& state = connections[requestId];
+            UInt64 ticket = state.nextTicket++;
+            state.reserved.push_back(ticket);
+            return ticket;
+        }
+
+        /**
+         * Take back the latest reservation of a request that was not queued; the ticket
+         * is then completed by the caller. Falls back to a new ticket if there is none
+         */
+        UInt64 Withdraw(const StdString& requestId) {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            ConnectionState& state = connections[requestId];
+            if (!state.reserved.empty()) {
+                UInt64 ticket = state.reserved.back();
+                state.reserved.pop_back();
+                return ticket;
+            }
+            return state.nextTicket++;
+        }
+
+        /**
+         * Hand in the response for a ticket. The sink is invoked, under the buffer lock, for
+         * this response and every parked successor that became releasable, in ticket order.
+         * A nullptr response still advances the sequence but is not passed to the sink.
+         */
+        template<typename Sink>
+        Void Complete(const StdString& requestId, UInt64 ticket, IHttpResponsePtr response, Sink&& sink) {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            auto it = connections.find(requestId);
+            if (it == connections.end()) {
+                if (response != nullptr) {
+                    sink(std::move(response));
+                }
+                return;
+            }
+
+            ConnectionState& state = it->second;
+            if (ticket != state.nextRelease) {
+                state.parked[ticket] = std::move(response);
+                return;
+            }
+
+            if (response != nullptr) {
+                sink(std::move(response));
+            }
+            state.nextRelease++;
+
+            // Release successors that were waiting on this ticket
+            auto parkedIt = state.parked.begin();
+            while (parkedIt != state.parked.end() && parkedIt->first == state.nextRelease) {
+                if (parkedIt->second != nullptr) {
+                    sink(std::move(parkedIt->second));
+                }
+                state.nextRelease++;
+                parkedIt = state.parked.erase(parkedIt);
+            }
+
+            // Nothing in flight for this connection any more
+            if (state.nextRelease == state.nextTicket) {
+                connections.erase(it);
+            }
+        }
+
+        /**
+         * Number of connections with requests still in flight
+         */
+        Size GetPendingConnectionCount() {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            return connections.size();
+        }
+};
+
+#endif // HTTP_RESPONSE_REORDER_BUFFER_H
@@ -0,0 +1,152 @@
+#ifndef HTTP_RESPONSE_WRITER_H
+#define HTTP_RESPONSE_WRITER_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+#include "HttpPipelineDefaults.h"
+#include "HttpStatus.h"
+#include <cstdio>
+#include <string_view>
+
+/**
+ * Serializes an IHttpResponse into HTTP/1.1 wire format in a reusable buffer
+ *
+ * The total size (status line, headers, Content-Length, body) is computed first so the
+ * buffer grows at most once, and the same buffer is reused for every response sent by
+ * its owner. Compared to IHttpResponse::ToHttpString(), no transient copy of the whole
+ * response is allocated per send.
+ *
+ * Not thread-safe: each sending processor owns one writer.
+ */
+class HttpResponseWriter {
+    Private StdString buffer;
+
+    Private Static Bool EqualsLowercase(std::string_view name, std::string_view lowercase) {
+        if (name.length() != lowercase.length()) {
+            return false;
+        }
+        for (Size i = 0; i < name.length(); i++) {
+            Char c = name[i];
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<Char>(c - 'A' + 'a');
+            }
+            if (c != lowercase[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Headers the writer derives itself: Content-Length always, the connection headers
+     * when the caller supplies them
+     */
+    Private Static Bool IsWrittenByWriter(std::string_view name, CBool connectionHeadersSupplied) {
+        return EqualsLowercase(name, "content-length") ||
+               (connectionHeadersSupplied && (EqualsLowercase(name, "connection") || EqualsLowercase(name, "keep-alive")));
+    }
+
+    Private Static Size DecimalLength(Size value) {
+        Size length = 1;
+        while (value >= 10) {
+            value /= 10;
+            length++;
+        }
+        return length;
+    }
+
+    Private Void AppendDecimal(Size value) {
+        Char digits[24];
+        Int length = snprintf(digits, sizeof(digits), "%lu", static_cast<unsigned long>(value));
+        buffer.append(digits, static_cast<Size>(length));
+    }
+
+    Private Void AppendHeader(std::string_view name, std::string_view value) {
+        buffer.append(name.data(), name.length());
+        buffer.append(": ", 2);
+        buffer.append(value.data(), value.length());
+        buffer.append("\r\n", 2);
+    }
+
+    Public HttpResponseWriter() = default;
+
+    /**
+     * @brief Render a response; the returned reference stays valid until the next Write()
+     * @param response Response to serialize
+     * @param connectionHeaders Preformatted "Name: value\r\n" lines replacing the response's
+     *        own Connection / Keep-Alive headers (see IHttpConnectionTracker); empty to keep them
+     * @return Wire bytes: status line, headers (Content-Length computed from the body), body
+     */
+    Public CStdString& Write(const IHttpResponse& response, std::string_view connectionHeaders = std::string_view()) {
+        CBool connectionHeadersSupplied = !connectionHeaders.empty();
+        CUInt statusCode = response.GetStatusCode();
+        CStdString statusMessage = response.GetStatusMessage();
+        const StdMap<StdString, StdString>& headers = response.GetHeaders();
+        CStdString& body = response.GetBody();
+
+        // Standard code and reason phrase: copy the precomputed status line
+        const HttpStatusLine* standardLine = FindStatusLine(statusCode);
+        if (standardLine != nullptr && standardLine->GetReasonPhrase() != statusMessage) {
+            standardLine = nullptr;  // Custom reason phrase
+        }
+
+        // "HTTP/1.1 " + code + " " + message + CRLF
+        Size total = standardLine != nullptr
+            ? standardLine->line.length()
+            : 9 + DecimalLength(statusCode) + 1 + statusMessage.length() + 2;
+        for (const auto& header : headers) {
+            if (!IsWrittenByWriter(header.first, connectionHeadersSupplied)) {
+                total += header.first.length() + 2 + header.second.length() + 2;
+            }
+        }
+        total += connectionHeaders.length();
+        total += 16 + DecimalLength(body.length()) + 2;  // "Content-Length: N\r\n"
+        total += 2 + body.length();                      // blank line + body
+
+        buffer.clear();
+        buffer.reserve(total);
+
+        if (standardLine != nullptr) {
+            buffer.append(standardLine->line.data(), standardLine->line.length());
+        } else {
+            buffer.append("HTTP/1.1 ", 9);
+            AppendDecimal(statusCode);
+            buffer.push_back(' ');
+            buffer.append(statusMessage);
+            buffer.append("\r\n", 2);
+        }
+
+        for (const auto& header : headers) {
+            // Always derived from the body actually written
+            if (!IsWrittenByWriter(header.first, connectionHeadersSupplied)) {
+                AppendHeader(header.first, header.second);
+            }
+        }
+        buffer.append(connectionHeaders.data(), connectionHeaders.length());
+        buffer.append("Content-Length: ", 16);
+        AppendDecimal(body.length());
+        buffer.append("\r\n\r\n", 4);
+        buffer.append(body);
+        return buffer;
+    }
+
+    /**
+     * @brief Bytes of the last rendered response
+     */
+    Public CStdString& GetBuffer() const {
+        return buffer;
+    }
+
+    /**
+     * @brief Drop the rendered bytes; release the storage if an unusually large response
+     *        grew it past HTTP_RESPONSE_WRITER_RETAIN_BYTES
+     */
+    Public Void Reset() {
+        buffer.clear();
+        if (buffer.capacity() > HTTP_RESPONSE_WRITER_RETAIN_BYTES) {
+            StdString().swap(buffer);
+        }
+    }
+};
+
+#endif // HTTP_RESPONSE_WRITER_H
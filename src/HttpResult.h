@@ -0,0 +1,83 @@
+#ifndef HTTPRESULT_H
+#define HTTPRESULT_H
+
+#include "StandardDefines.h"
+#include "HttpStatus.h"
+#include "ResponseEntity.h"
+#include <optional>
+#include <utility>
+
+/**
+ * Handler return type that is either a ResponseEntity<T> or an error (status + message),
+ * so controllers can report failures without throwing
+ *
+ * @tparam T The type of the response body on success (Void for none)
+ *
+ * An error is answered as {"error":"<reason phrase>","message":"<message>"} with its status.
+ *
+ * Example usage:
+ *   HttpResult<DeviceInfo> GetDevice(Int id) {
+ *       if (id < 0) {
+ *           return HttpResult<DeviceInfo>::Error(HttpStatus::NOT_FOUND, "No such device");
+ *       }
+ *       return ResponseEntity<DeviceInfo>::Ok(LoadDevice(id));
+ *   }
+ */
+template<typename T>
+class HttpResult {
+    Private std::optional<ResponseEntity<T>> entity;
+    Private HttpStatus errorStatus;
+    Private StdString errorMessage;
+
+    Private HttpResult(HttpStatus status, StdString message)
+        : entity(), errorStatus(status), errorMessage(std::move(message)) {
+    }
+
+    /**
+     * Success: the entity is answered as a handler returning ResponseEntity<T> would be
+     */
+    Public HttpResult(ResponseEntity<T> successEntity)
+        : entity(std::move(successEntity)), errorStatus(HttpStatus::OK), errorMessage() {
+    }
+
+    /**
+     * Error with the given status (4xx/5xx) and message
+     */
+    Public Static HttpResult<T> Error(HttpStatus status, StdString message) {
+        return HttpResult<T>(status, std::move(message));
+    }
+
+    /**
+     * True when the result holds an error instead of an entity
+     */
+    Public Bool IsError() const {
+        return !entity.has_value();
+    }
+
+    /**
+     * Status that will be sent: the entity's on success, the error status otherwise
+     */
+    Public HttpStatus GetStatus() const {
+        return entity.has_value() ? entity->GetStatus() : errorStatus;
+    }
+
+    /**
+     * The success entity (only valid when !IsError())
+     */
+    Public ResponseEntity<T>& GetEntity() {
+        return *entity;
+    }
+
+    Public const ResponseEntity<T>& GetEntity() const {
+        return *entity;
+    }
+
+    /**
+     * The error message (empty on success)
+     */
+    Public CStdString& GetErrorMessage() const {
+        return errorMessage;
+    }
+};
+
+#endif // HTTPRESULT_H
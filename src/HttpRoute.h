@@ -0,0 +1,77 @@
+#ifndef HTTP_ROUTE_H
+#define HTTP_ROUTE_H
+
+#include <StandardDefines.h>
+#include <IHttpRequest.h>
+#include <IHttpResponse.h>
+
+class HttpRequestContext;
+
+/**
+ * Handler invoked for a matched route: request context (body and path variable views) in,
+ * response out. A plain function pointer (generated handlers are capture-less lambdas), so
+ * route tables can be constant-initialized.
+ */
+using HttpRouteHandler = IHttpResponsePtr (*)(const HttpRequestContext& context);
+
+/**
+ * HttpRoute::cacheTtlMs values with a special meaning
+ */
+static constexpr UInt HttpRouteNotCached = 0;                      // Controller runs for every request
+static constexpr UInt HttpRouteCacheUntilInvalidated = 0xFFFFFFFFu;  // @Cacheable without a TTL
+
+/**
+ * One entry of the routing table: method + URL pattern -> handler.
+ * The pre-build generates a static array of these inside
+ * HttpRequestDispatcher::InitializeMappings().
+ */
+struct HttpRoute {
+    HttpMethod method;
+    CChar* pattern;           // e.g. "/api/user/{userId}/get"
+    HttpRouteHandler handler;
+    UInt cacheTtlMs = HttpRouteNotCached;  // @Cacheable(ttlMs) GET routes
+    Bool noCompression = false;            // @NoCompression: body always sent as-is
+};
+
+/**
+ * Number of HTTP methods, i.e. slots in a per-method handler array
+ */
+static constexpr Size HttpMethodCount = 9;
+
+/**
+ * Dense index of an HTTP method, for per-method arrays
+ */
+inline Size HttpMethodIndex(HttpMethod method) {
+    switch (method) {
+        case HttpMethod::GET: return 0;
+        case HttpMethod::POST: return 1;
+        case HttpMethod::PUT: return 2;
+        case HttpMethod::PATCH: return 3;
+        case HttpMethod::DELETE: return 4;
+        case HttpMethod::OPTIONS: return 5;
+        case HttpMethod::HEAD: return 6;
+        case HttpMethod::TRACE: return 7;
+        case HttpMethod::CONNECT: return 8;
+    }
+    return 0;
+}
+
+/**
+ * Request-line token of an HTTP method
+ */
+inline CChar* HttpMethodName(HttpMethod method) {
+    switch (method) {
+        case HttpMethod::GET: return "GET";
+        case HttpMethod::POST: return "POST";
+        case HttpMethod::PUT: return "PUT";
+        case HttpMethod::PATCH: return "PATCH";
+        case HttpMethod::DELETE: return "DELETE";
+        case HttpMethod::OPTIONS: return "OPTIONS";
+        case HttpMethod::HEAD: return "HEAD";
+        case HttpMethod::TRACE: return "TRACE";
+        case HttpMethod::CONNECT: return "CONNECT";
+    }
+    return "GET";
+}
+
+#endif // HTTP_ROUTE_H
@@ -2,6 +2,9 @@
 #define HTTPSTATUS_H
 
 #include "StandardDefines.h"
+#include <string_view>
+#include <charconv>
+#include <system_error>
 
 /**
  * Enumeration of HTTP status codes
@@ -81,85 +84,179 @@ enum class HttpStatus : UInt {
     NETWORK_AUTHENTICATION_REQUIRED = 511
 };
 
+/**
+ * Status code, its digits and reason phrase, in ascending code order.
+ * Source of the status text / status line tables below.
+ */
+#define HTTP_STATUS_LIST(X) \
+    /* 1xx Informational */ \
+    X(CONTINUE, "100", "Continue") \
+    X(SWITCHING_PROTOCOLS, "101", "Switching Protocols") \
+    X(PROCESSING, "102", "Processing") \
+    X(EARLY_HINTS, "103", "Early Hints") \
+    \
+    /* 2xx Success */ \
+    X(OK, "200", "OK") \
+    X(CREATED, "201", "Created") \
+    X(ACCEPTED, "202", "Accepted") \
+    X(NON_AUTHORITATIVE_INFORMATION, "203", "Non-Authoritative Information") \
+    X(NO_CONTENT, "204", "No Content") \
+    X(RESET_CONTENT, "205", "Reset Content") \
+    X(PARTIAL_CONTENT, "206", "Partial Content") \
+    X(MULTI_STATUS, "207", "Multi-Status") \
+    X(ALREADY_REPORTED, "208", "Already Reported") \
+    X(IM_USED, "226", "IM Used") \
+    \
+    /* 3xx Redirection */ \
+    X(MULTIPLE_CHOICES, "300", "Multiple Choices") \
+    X(MOVED_PERMANENTLY, "301", "Moved Permanently") \
+    X(FOUND, "302", "Found") \
+    X(SEE_OTHER, "303", "See Other") \
+    X(NOT_MODIFIED, "304", "Not Modified") \
+    X(USE_PROXY, "305", "Use Proxy") \
+    X(TEMPORARY_REDIRECT, "307", "Temporary Redirect") \
+    X(PERMANENT_REDIRECT, "308", "Permanent Redirect") \
+    \
+    /* 4xx Client Error */ \
+    X(BAD_REQUEST, "400", "Bad Request") \
+    X(UNAUTHORIZED, "401", "Unauthorized") \
+    X(PAYMENT_REQUIRED, "402", "Payment Required") \
+    X(FORBIDDEN, "403", "Forbidden") \
+    X(NOT_FOUND, "404", "Not Found") \
+    X(METHOD_NOT_ALLOWED, "405", "Method Not Allowed") \
+    X(NOT_ACCEPTABLE, "406", "Not Acceptable") \
+    X(PROXY_AUTHENTICATION_REQUIRED, "407", "Proxy Authentication Required") \
+    X(REQUEST_TIMEOUT, "408", "Request Timeout") \
+    X(CONFLICT, "409", "Conflict") \
+    X(GONE, "410", "Gone") \
+    X(LENGTH_REQUIRED, "411", "Length Required") \
+    X(PRECONDITION_FAILED, "412", "Precondition Failed") \
+    X(PAYLOAD_TOO_LARGE, "413", "Payload Too Large") \
+    X(URI_TOO_LONG, "414", "URI Too Long") \
+    X(UNSUPPORTED_MEDIA_TYPE, "415", "Unsupported Media Type") \
+    X(RANGE_NOT_SATISFIABLE, "416", "Range Not Satisfiable") \
+    X(EXPECTATION_FAILED, "417", "Expectation Failed") \
+    X(IM_A_TEAPOT, "418", "I'm a teapot") \
+    X(MISDIRECTED_REQUEST, "421", "Misdirected Request") \
+    X(UNPROCESSABLE_ENTITY, "422", "Unprocessable Entity") \
+    X(LOCKED, "423", "Locked") \
+    X(FAILED_DEPENDENCY, "424", "Failed Dependency") \
+    X(TOO_EARLY, "425", "Too Early") \
+    X(UPGRADE_REQUIRED, "426", "Upgrade Required") \
+    X(PRECONDITION_REQUIRED, "428", "Precondition Required") \
+    X(TOO_MANY_REQUESTS, "429", "Too Many Requests") \
+    X(REQUEST_HEADER_FIELDS_TOO_LARGE, "431", "Request Header Fields Too Large") \
+    X(UNAVAILABLE_FOR_LEGAL_REASONS, "451", "Unavailable For Legal Reasons") \
+    \
+    /* 5xx Server Error */ \
+    X(INTERNAL_SERVER_ERROR, "500", "Internal Server Error") \
+    X(NOT_IMPLEMENTED, "501", "Not Implemented") \
+    X(BAD_GATEWAY, "502", "Bad Gateway") \
+    X(SERVICE_UNAVAILABLE, "503", "Service Unavailable") \
+    X(GATEWAY_TIMEOUT, "504", "Gateway Timeout") \
+    X(HTTP_VERSION_NOT_SUPPORTED, "505", "HTTP Version Not Supported") \
+    X(VARIANT_ALSO_NEGOTIATES, "506", "Variant Also Negotiates") \
+    X(INSUFFICIENT_STORAGE, "507", "Insufficient Storage") \
+    X(LOOP_DETECTED, "508", "Loop Detected") \
+    X(NOT_EXTENDED, "510", "Not Extended") \
+    X(NETWORK_AUTHENTICATION_REQUIRED, "511", "Network Authentication Required")
+
+/**
+ * Ready-made status line for one status code, e.g. "HTTP/1.1 404 Not Found\r\n"
+ */
+struct HttpStatusLine {
+    UInt code;
+    std::string_view line;
+
+    // Reason phrase, e.g. "Not Found" (between "HTTP/1.1 404 " and the CRLF)
+    constexpr std::string_view GetReasonPhrase() const {
+        return line.substr(13, line.length() - 15);
+    }
+};
+
+#define HTTP_STATUS_LINE_ENTRY(name, digits, text) \
+    HttpStatusLine{static_cast<UInt>(HttpStatus::name), "HTTP/1.1 " digits " " text "\r\n"},
+
+inline constexpr HttpStatusLine HttpStatusLines[] = {
+    HTTP_STATUS_LIST(HTTP_STATUS_LINE_ENTRY)
+};
+
+#undef HTTP_STATUS_LINE_ENTRY
+
+inline constexpr Size HttpStatusLineCount = sizeof(HttpStatusLines) / sizeof(HttpStatusLines[0]);
+
+// Status codes below this have a slot in the lookup index
+inline constexpr UInt HttpStatusCodeLimit = 600;
+
+/**
+ * Dense code -> HttpStatusLines index (1-based, 0 = unknown code), built at compile time
+ */
+struct HttpStatusLineIndex {
+    UInt8 slots[HttpStatusCodeLimit];
+};
+
+constexpr HttpStatusLineIndex BuildHttpStatusLineIndex() {
+    HttpStatusLineIndex index{};
+    for (Size i = 0; i < HttpStatusLineCount; i++) {
+        index.slots[HttpStatusLines[i].code] = static_cast<UInt8>(i + 1);
+    }
+    return index;
+}
+
+inline constexpr HttpStatusLineIndex HttpStatusLineSlots = BuildHttpStatusLineIndex();
+
+constexpr Bool HttpStatusDigitsMatchCodes() {
+    for (Size i = 0; i < HttpStatusLineCount; i++) {
+        const HttpStatusLine& entry = HttpStatusLines[i];
+        UInt digits = static_cast<UInt>(entry.line[9] - '0') * 100 +
+                      static_cast<UInt>(entry.line[10] - '0') * 10 +
+                      static_cast<UInt>(entry.line[11] - '0');
+        if (digits != entry.code) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(HttpStatusDigitsMatchCodes(), "HTTP_STATUS_LIST digits must match the HttpStatus values");
+static_assert(HttpStatusLineCount < 256, "HttpStatusLineIndex slots are 8-bit");
+
+/**
+ * Find the table entry for a status code
+ * @return nullptr for codes not in HttpStatus
+ */
+constexpr const HttpStatusLine* FindStatusLine(CUInt code) {
+    if (code >= HttpStatusCodeLimit || HttpStatusLineSlots.slots[code] == 0) {
+        return nullptr;
+    }
+    return &HttpStatusLines[HttpStatusLineSlots.slots[code] - 1];
+}
+
+/**
+ * Status line bytes for a code, e.g. "HTTP/1.1 200 OK\r\n"; empty for unknown codes
+ */
+constexpr std::string_view GetStatusLine(CUInt code) {
+    const HttpStatusLine* entry = FindStatusLine(code);
+    return entry != nullptr ? entry->line : std::string_view();
+}
+
+constexpr std::string_view GetStatusLine(HttpStatus code) {
+    return GetStatusLine(static_cast<UInt>(code));
+}
+
+/**
+ * Reason phrase for a status code without allocating ("Unknown" for unknown codes)
+ */
+constexpr std::string_view GetStatusText(HttpStatus code) {
+    const HttpStatusLine* entry = FindStatusLine(static_cast<UInt>(code));
+    return entry != nullptr ? entry->GetReasonPhrase() : std::string_view("Unknown");
+}
+
 /**
  * Helper function to get the standard status message for a status code
  */
 inline StdString GetStatusMessage(HttpStatus code) {
-    switch (code) {
-        // 1xx Informational
-        case HttpStatus::CONTINUE: return "Continue";
-        case HttpStatus::SWITCHING_PROTOCOLS: return "Switching Protocols";
-        case HttpStatus::PROCESSING: return "Processing";
-        case HttpStatus::EARLY_HINTS: return "Early Hints";
-        
-        // 2xx Success
-        case HttpStatus::OK: return "OK";
-        case HttpStatus::CREATED: return "Created";
-        case HttpStatus::ACCEPTED: return "Accepted";
-        case HttpStatus::NON_AUTHORITATIVE_INFORMATION: return "Non-Authoritative Information";
-        case HttpStatus::NO_CONTENT: return "No Content";
-        case HttpStatus::RESET_CONTENT: return "Reset Content";
-        case HttpStatus::PARTIAL_CONTENT: return "Partial Content";
-        case HttpStatus::MULTI_STATUS: return "Multi-Status";
-        case HttpStatus::ALREADY_REPORTED: return "Already Reported";
-        case HttpStatus::IM_USED: return "IM Used";
-        
-        // 3xx Redirection
-        case HttpStatus::MULTIPLE_CHOICES: return "Multiple Choices";
-        case HttpStatus::MOVED_PERMANENTLY: return "Moved Permanently";
-        case HttpStatus::FOUND: return "Found";
-        case HttpStatus::SEE_OTHER: return "See Other";
-        case HttpStatus::NOT_MODIFIED: return "Not Modified";
-        case HttpStatus::USE_PROXY: return "Use Proxy";
-        case HttpStatus::TEMPORARY_REDIRECT: return "Temporary Redirect";
-        case HttpStatus::PERMANENT_REDIRECT: return "Permanent Redirect";
-        
-        // 4xx Client Error
-        case HttpStatus::BAD_REQUEST: return "Bad Request";
-        case HttpStatus::UNAUTHORIZED: return "Unauthorized";
-        case HttpStatus::PAYMENT_REQUIRED: return "Payment Required";
-        case HttpStatus::FORBIDDEN: return "Forbidden";
-        case HttpStatus::NOT_FOUND: return "Not Found";
-        case HttpStatus::METHOD_NOT_ALLOWED: return "Method Not Allowed";
-        case HttpStatus::NOT_ACCEPTABLE: return "Not Acceptable";
-        case HttpStatus::PROXY_AUTHENTICATION_REQUIRED: return "Proxy Authentication Required";
-        case HttpStatus::REQUEST_TIMEOUT: return "Request Timeout";
-        case HttpStatus::CONFLICT: return "Conflict";
-        case HttpStatus::GONE: return "Gone";
-        case HttpStatus::LENGTH_REQUIRED: return "Length Required";
-        case HttpStatus::PRECONDITION_FAILED: return "Precondition Failed";
-        case HttpStatus::PAYLOAD_TOO_LARGE: return "Payload Too Large";
-        case HttpStatus::URI_TOO_LONG: return "URI Too Long";
-        case HttpStatus::UNSUPPORTED_MEDIA_TYPE: return "Unsupported Media Type";
-        case HttpStatus::RANGE_NOT_SATISFIABLE: return "Range Not Satisfiable";
-        case HttpStatus::EXPECTATION_FAILED: return "Expectation Failed";
-        case HttpStatus::IM_A_TEAPOT: return "I'm a teapot";
-        case HttpStatus::MISDIRECTED_REQUEST: return "Misdirected Request";
-        case HttpStatus::UNPROCESSABLE_ENTITY: return "Unprocessable Entity";
-        case HttpStatus::LOCKED: return "Locked";
-        case HttpStatus::FAILED_DEPENDENCY: return "Failed Dependency";
-        case HttpStatus::TOO_EARLY: return "Too Early";
-        case HttpStatus::UPGRADE_REQUIRED: return "Upgrade Required";
-        case HttpStatus::PRECONDITION_REQUIRED: return "Precondition Required";
-        case HttpStatus::TOO_MANY_REQUESTS: return "Too Many Requests";
-        case HttpStatus::REQUEST_HEADER_FIELDS_TOO_LARGE: return "Request Header Fields Too Large";
-        case HttpStatus::UNAVAILABLE_FOR_LEGAL_REASONS: return "Unavailable For Legal Reasons";
-        
-        // 5xx Server Error
-        case HttpStatus::INTERNAL_SERVER_ERROR: return "Internal Server Error";
-        case HttpStatus::NOT_IMPLEMENTED: return "Not Implemented";
-        case HttpStatus::BAD_GATEWAY: return "Bad Gateway";
-        case HttpStatus::SERVICE_UNAVAILABLE: return "Service Unavailable";
-        case HttpStatus::GATEWAY_TIMEOUT: return "Gateway Timeout";
-        case HttpStatus::HTTP_VERSION_NOT_SUPPORTED: return "HTTP Version Not Supported";
-        case HttpStatus::VARIANT_ALSO_NEGOTIATES: return "Variant Also Negotiates";
-        case HttpStatus::INSUFFICIENT_STORAGE: return "Insufficient Storage";
-        case HttpStatus::LOOP_DETECTED: return "Loop Detected";
-        case HttpStatus::NOT_EXTENDED: return "Not Extended";
-        case HttpStatus::NETWORK_AUTHENTICATION_REQUIRED: return "Network Authentication Required";
-        
-        default: return "Unknown";
-    }
+    return StdString(GetStatusText(code));
 }
 
 /**
@@ -231,15 +328,21 @@ inline StdString StatusToString(HttpStatus code) {
 }
 
 /**
- * Helper function to convert string to HttpStatus enum
+ * Helper function to convert string to HttpStatus enum (no exceptions; leading blanks
+ * and trailing characters are ignored like std::stoul did)
  */
 inline HttpStatus StringToStatus(CStdString& codeStr) {
-    try {
-        UInt code = std::stoul(codeStr);
-        return static_cast<HttpStatus>(code);
-    } catch (...) {
+    CChar* begin = codeStr.data();
+    CChar* end = begin + codeStr.length();
+    while (begin != end && (*begin == ' ' || *begin == '\t')) {
+        begin++;
+    }
+    UInt code = 0;
+    std::from_chars_result parsed = std::from_chars(begin, end, code);
+    if (parsed.ec != std::errc()) {
         return HttpStatus::BAD_REQUEST; // Default to bad request if parsing fails
     }
+    return static_cast<HttpStatus>(code);
 }
 
 #endif // HTTPSTATUS_H
@@ -0,0 +1,49 @@
+#ifndef I_HTTP_BODY_STREAM_H
+#define I_HTTP_BODY_STREAM_H
+
+#include <StandardDefines.h>
+#include <string_view>
+
+// Forward declarations
+DefineStandardPointers(IHttpBodyStream)
+class IHttpBodyStream {
+
+    Public Virtual ~IHttpBodyStream() = default;
+
+    // ============================================================================
+    // BODY STREAM OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Copies the next bytes of the body into a caller buffer
+     * @param buffer Destination
+     * @param capacity Size of buffer in bytes
+     * @return Number of bytes copied, 0 once the whole body has been read
+     */
+    Public Virtual Size Read(Char* buffer, CSize capacity) = 0;
+
+    /**
+     * @brief Returns the next bytes of the body without copying them
+     * @param maxBytes Largest chunk wanted
+     * @return View of at most maxBytes bytes, valid until the next call on the stream;
+     *         empty once the whole body has been read
+     */
+    Public Virtual std::string_view ReadChunk(CSize maxBytes) = 0;
+
+    /**
+     * @brief Total body size in bytes as announced by the request (Content-Length)
+     */
+    Public Virtual Size GetContentLength() const = 0;
+
+    /**
+     * @brief Number of body bytes consumed so far
+     */
+    Public Virtual Size GetBytesRead() const = 0;
+
+    /**
+     * @brief True once every body byte has been consumed
+     */
+    Public Virtual Bool IsComplete() const = 0;
+};
+
+#endif // I_HTTP_BODY_STREAM_H
@@ -0,0 +1,24 @@
+#ifndef I_HTTP_CLOUD_RESPONSE_PROCESSOR_H
+#define I_HTTP_CLOUD_RESPONSE_PROCESSOR_H
+
+#include <StandardDefines.h>
+
+// Forward declarations
+DefineStandardPointers(IHttpCloudResponseProcessor)
+class IHttpCloudResponseProcessor {
+
+    Public Virtual ~IHttpCloudResponseProcessor() = default;
+
+    // ============================================================================
+    // HTTP CLOUD RESPONSE PROCESSING OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Takes up to maxCount responses off the cloud queue and sends them to the cloud transport
+     * @param maxCount Upper bound of responses handled by this call
+     * @return Number of responses taken off the queue (sent or discarded)
+     */
+    Public Virtual Size ProcessResponses(CSize maxCount) = 0;
+};
+
+#endif // I_HTTP_CLOUD_RESPONSE_PROCESSOR_H
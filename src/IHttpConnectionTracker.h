@@ -0,0 +1,47 @@
+#ifndef I_HTTP_CONNECTION_TRACKER_H
+#define I_HTTP_CONNECTION_TRACKER_H
+
+#include <StandardDefines.h>
+
+// Forward declarations
+DefineStandardPointers(IHttpConnectionTracker)
+class IHttpConnectionTracker {
+
+    Public Virtual ~IHttpConnectionTracker() = default;
+
+    // ============================================================================
+    // CONNECTION TRACKING OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Records a request admitted on a connection, in arrival order
+     * @param requestId Connection id of the request
+     * @param connectionHeader Value of the request's Connection header, empty if absent
+     *        ("close" asks for the connection to be closed after its response)
+     */
+    Public Virtual Void OnRequest(CStdString& requestId, CStdString& connectionHeader) = 0;
+
+    /**
+     * @brief Decides keep-alive for the next response sent on a connection. Call once per
+     *        response, in send order, from the sending thread.
+     * @param requestId Connection id of the response
+     * @return Header lines to add ("Connection: keep-alive\r\nKeep-Alive: timeout=5, max=99\r\n"
+     *         or "Connection: close\r\n"); empty for connections that were never seen by
+     *         OnRequest()
+     */
+    Public Virtual StdString OnResponse(CStdString& requestId) = 0;
+
+    /**
+     * @brief Forgets connections idle for longer than the keep-alive timeout, freeing their
+     *        keep-alive slots
+     * @return Number of connections expired
+     */
+    Public Virtual Size ExpireIdleConnections() = 0;
+
+    /**
+     * @brief Number of connections currently tracked
+     */
+    Public Virtual Size GetConnectionCount() = 0;
+};
+
+#endif // I_HTTP_CONNECTION_TRACKER_H
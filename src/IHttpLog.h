@@ -0,0 +1,102 @@
+#ifndef I_HTTP_LOG_H
+#define I_HTTP_LOG_H
+
+#include <StandardDefines.h>
+#include "HttpPipelineDefaults.h"
+#include <cstdarg>
+
+/**
+ * @brief Severity of a log record (values match the HTTP_LOG_LEVEL_* build levels)
+ */
+enum class HttpLogLevel {
+    Error = HTTP_LOG_LEVEL_ERROR,
+    Warning = HTTP_LOG_LEVEL_WARNING,
+    Info = HTTP_LOG_LEVEL_INFO,
+    Debug = HTTP_LOG_LEVEL_DEBUG
+};
+
+// Forward declarations
+DefineStandardPointers(IHttpLog)
+class IHttpLog {
+
+    Public Virtual ~IHttpLog() = default;
+
+    // ============================================================================
+    // LOGGING OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Formats and records a message. Call through the HTTP_LOG_* macros, which
+     *        strip disabled levels at compile time. Thread-safe, never blocks.
+     * @param level Severity
+     * @param format printf-style format
+     * @param arguments Format arguments
+     */
+    Public Virtual Void Write(HttpLogLevel level, CChar* format, va_list arguments) = 0;
+
+    /**
+     * @brief Hands buffered records to the ILogger sink, oldest first. Called by the
+     *        request loop outside of request processing.
+     * @param maxRecords Upper bound of records to forward
+     * @return Number of records forwarded
+     */
+    Public Virtual Size Drain(CSize maxRecords) = 0;
+
+    /**
+     * @brief Gets the number of records discarded because the buffer was full
+     * @return Dropped record count
+     */
+    Public Virtual Size GetDroppedCount() const = 0;
+};
+
+#if defined(__GNUC__)
+__attribute__((format(printf, 3, 4)))
+#endif
+inline Void HttpLogWrite(const IHttpLogPtr& log, HttpLogLevel level, CChar* format, ...) {
+    if (log == nullptr) {
+        return;
+    }
+    va_list arguments;
+    va_start(arguments, format);
+    log->Write(level, format, arguments);
+    va_end(arguments);
+}
+
+/**
+ * Operands of a compiled-out log call: only named inside sizeof, so they count as used
+ * (no unused-parameter warnings in non-debug builds) but are never evaluated
+ */
+template<typename... Args>
+Int HttpLogDiscard(const Args&... arguments);
+
+#define HTTP_LOG_DISCARD(log, ...) ((void)sizeof(HttpLogDiscard((log), __VA_ARGS__)))
+
+/**
+ * Logging macros: HTTP_LOG_INFO(httpLog, "Received %u requests", count)
+ * Levels above HTTP_LOG_LEVEL compile to nothing; arguments are not evaluated.
+ */
+#if HTTP_LOG_LEVEL >= HTTP_LOG_LEVEL_ERROR
+    #define HTTP_LOG_ERROR(log, ...) HttpLogWrite((log), HttpLogLevel::Error, __VA_ARGS__)
+#else
+    #define HTTP_LOG_ERROR(log, ...) HTTP_LOG_DISCARD(log, __VA_ARGS__)
+#endif
+
+#if HTTP_LOG_LEVEL >= HTTP_LOG_LEVEL_WARNING
+    #define HTTP_LOG_WARNING(log, ...) HttpLogWrite((log), HttpLogLevel::Warning, __VA_ARGS__)
+#else
+    #define HTTP_LOG_WARNING(log, ...) HTTP_LOG_DISCARD(log, __VA_ARGS__)
+#endif
+
+#if HTTP_LOG_LEVEL >= HTTP_LOG_LEVEL_INFO
+    #define HTTP_LOG_INFO(log, ...) HttpLogWrite((log), HttpLogLevel::Info, __VA_ARGS__)
+#else
+    #define HTTP_LOG_INFO(log, ...) HTTP_LOG_DISCARD(log, __VA_ARGS__)
+#endif
+
+#if HTTP_LOG_LEVEL >= HTTP_LOG_LEVEL_DEBUG
+    #define HTTP_LOG_DEBUG(log, ...) HttpLogWrite((log), HttpLogLevel::Debug, __VA_ARGS__)
+#else
+    #define HTTP_LOG_DEBUG(log, ...) HTTP_LOG_DISCARD(log, __VA_ARGS__)
+#endif
+
+#endif // I_HTTP_LOG_H
@@ -0,0 +1,75 @@
+#ifndef I_HTTP_METRICS_H
+#define I_HTTP_METRICS_H
+
+#include <StandardDefines.h>
+#include "HttpRoute.h"
+#include <chrono>
+
+/**
+ * @brief Timed sections of a request's trip through the pipeline
+ */
+enum class HttpPipelineStage {
+    // Trie match of the request path
+    Routing,
+    // Controller call including body (de)serialization, or the cache lookup on a hit, plus
+    // response compression
+    Handler,
+    // Rendering the response into its wire format
+    Serialization,
+    // Handing the rendered response to the server
+    Send
+};
+
+static constexpr Size HttpPipelineStageCount = 4;
+
+/**
+ * @brief Monotonic timestamp for metrics, in nanoseconds
+ */
+inline UInt64 HttpMetricsNow() {
+    return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Forward declarations
+DefineStandardPointers(IHttpMetrics)
+class IHttpMetrics {
+
+    Public Virtual ~IHttpMetrics() = default;
+
+    // ============================================================================
+    // RECORDING (lock-free, callable from any worker)
+    // ============================================================================
+
+    /**
+     * @brief Counts a dispatched request against its route
+     * @param route Matched route (the key; its pattern labels the series)
+     * @param statusCode Status of the response sent
+     * @param latencyNs Time from routing start to the finished response
+     */
+    Public Virtual Void RecordRequest(const HttpRoute* route, CUInt statusCode, UInt64 latencyNs) = 0;
+
+    /**
+     * @brief Counts a request that matched no route (answered 404/405)
+     */
+    Public Virtual Void RecordUnmatched() = 0;
+
+    /**
+     * @brief Adds the time spent in one pipeline stage
+     * @param stage Stage
+     * @param elapsedNs Duration in nanoseconds
+     */
+    Public Virtual Void RecordStage(HttpPipelineStage stage, UInt64 elapsedNs) = 0;
+
+    // ============================================================================
+    // EXPORT
+    // ============================================================================
+
+    /**
+     * @brief Renders all metrics in the Prometheus text exposition format (served at
+     *        HTTP_METRICS_PATH), including current queue depths
+     * @return Metrics text
+     */
+    Public Virtual StdString Render() const = 0;
+};
+
+#endif // I_HTTP_METRICS_H
@@ -0,0 +1,260 @@
+#ifndef I_HTTP_PIPELINE_CONFIG_H
+#define I_HTTP_PIPELINE_CONFIG_H
+
+#include <StandardDefines.h>
+
+/**
+ * @brief How HttpRequestManager::RetrieveRequest drives the pipeline
+ */
+enum class HttpRequestLoopMode {
+    // Poll both servers once, drain the queues, then sleep for a fixed delay
+    Polling,
+    // Keep draining while there is work, sleep only when everything is idle
+    EventDriven
+};
+
+/**
+ * @brief What happens to a new request when the request queue is at capacity
+ */
+enum class HttpQueueOverflowPolicy {
+    // Stop receiving until the queue has room; requests wait inside the server
+    Block,
+    // Discard the oldest queued request to make room
+    DropOldest,
+    // Answer immediately with 503 Service Unavailable
+    RejectWithServiceUnavailable
+};
+
+/**
+ * @brief Which threads run the request pipeline
+ */
+enum class HttpExecutionMode {
+    // The thread calling RetrieveRequest receives, dispatches and sends
+    Shared,
+    // StartServer starts a network thread and dispatch threads, each bound to a core
+    Pinned
+};
+
+// Forward declarations
+DefineStandardPointers(IHttpPipelineConfig)
+class IHttpPipelineConfig {
+
+    Public Virtual ~IHttpPipelineConfig() = default;
+
+    // ============================================================================
+    // REQUEST LOOP
+    // ============================================================================
+
+    /**
+     * @brief Gets the loop mode used by the request manager
+     * @return Current loop mode
+     */
+    Public Virtual HttpRequestLoopMode GetLoopMode() const = 0;
+
+    /**
+     * @brief Sets the loop mode used by the request manager
+     * @param mode Loop mode to use from the next iteration on
+     */
+    Public Virtual Void SetLoopMode(HttpRequestLoopMode mode) = 0;
+
+    /**
+     * @brief Gets the fixed delay of the polling loop
+     * @return Delay in milliseconds
+     */
+    Public Virtual UInt GetPollingDelayMs() const = 0;
+
+    /**
+     * @brief Sets the fixed delay of the polling loop
+     * @param delayMs Delay in milliseconds
+     */
+    Public Virtual Void SetPollingDelayMs(CUInt delayMs) = 0;
+
+    /**
+     * @brief Gets the longest idle sleep of the event-driven loop
+     * @return Wait time in milliseconds
+     */
+    Public Virtual UInt GetIdleWaitMs() const = 0;
+
+    /**
+     * @brief Sets the longest idle sleep of the event-driven loop
+     * @param waitMs Wait time in milliseconds
+     */
+    Public Virtual Void SetIdleWaitMs(CUInt waitMs) = 0;
+
+    /**
+     * @brief Gets the maximum number of requests taken from each server per loop pass
+     * @return Request count
+     */
+    Public Virtual UInt GetMaxRequestsPerPass() const = 0;
+
+    /**
+     * @brief Sets the maximum number of requests taken from each server per loop pass
+     * @param count Request count (0 is treated as 1)
+     */
+    Public Virtual Void SetMaxRequestsPerPass(CUInt count) = 0;
+
+    /**
+     * @brief Gets the number of responses sent per batch
+     * @return Batch size
+     */
+    Public Virtual UInt GetResponseBatchSize() const = 0;
+
+    /**
+     * @brief Sets the number of responses sent per batch
+     * @param count Batch size (0 is treated as 1)
+     */
+    Public Virtual Void SetResponseBatchSize(CUInt count) = 0;
+
+    /**
+     * @brief Gets the number of cloud responses sent per loop pass
+     * @return Batch size
+     */
+    Public Virtual UInt GetCloudResponseBatchSize() const = 0;
+
+    /**
+     * @brief Sets the number of cloud responses sent per loop pass
+     * @param count Batch size (0 is treated as 1)
+     */
+    Public Virtual Void SetCloudResponseBatchSize(CUInt count) = 0;
+
+    /**
+     * @brief Gets the cloud queue length at which request admission pauses
+     * @return High-water mark
+     */
+    Public Virtual UInt GetCloudResponseHighWaterMark() const = 0;
+
+    /**
+     * @brief Sets the cloud queue length at which request admission pauses
+     * @param count High-water mark (0 is treated as 1)
+     */
+    Public Virtual Void SetCloudResponseHighWaterMark(CUInt count) = 0;
+
+    // ============================================================================
+    // QUEUES
+    // ============================================================================
+
+    /**
+     * @brief Gets the maximum number of queued requests
+     * @return Capacity
+     */
+    Public Virtual UInt GetRequestQueueCapacity() const = 0;
+
+    /**
+     * @brief Sets the maximum number of queued requests
+     * @param capacity Capacity (0 is treated as 1)
+     */
+    Public Virtual Void SetRequestQueueCapacity(CUInt capacity) = 0;
+
+    /**
+     * @brief Gets the queued responses per local/cloud queue at which request admission
+     *        pauses
+     * @return Capacity
+     */
+    Public Virtual UInt GetResponseQueueCapacity() const = 0;
+
+    /**
+     * @brief Sets the queued responses per local/cloud queue at which request admission
+     *        pauses (the lock-free queue can only lower HTTP_RESPONSE_QUEUE_CAPACITY)
+     * @param capacity Capacity (0 is treated as 1)
+     */
+    Public Virtual Void SetResponseQueueCapacity(CUInt capacity) = 0;
+
+    /**
+     * @brief Gets the policy applied when the request queue is full
+     * @return Overflow policy
+     */
+    Public Virtual HttpQueueOverflowPolicy GetOverflowPolicy() const = 0;
+
+    /**
+     * @brief Sets the policy applied when the request queue is full
+     * @param policy Overflow policy
+     */
+    Public Virtual Void SetOverflowPolicy(HttpQueueOverflowPolicy policy) = 0;
+
+    // ============================================================================
+    // REQUEST WORKERS
+    // ============================================================================
+
+    /**
+     * @brief Gets the number of workers dispatching requests concurrently
+     * @return Worker count (1 = inline on the loop thread)
+     */
+    Public Virtual UInt GetWorkerCount() const = 0;
+
+    /**
+     * @brief Sets the number of workers dispatching requests concurrently
+     * @param count Worker count (0 is treated as 1)
+     */
+    Public Virtual Void SetWorkerCount(CUInt count) = 0;
+
+    // ============================================================================
+    // CORE AFFINITY
+    // ============================================================================
+
+    /**
+     * @brief Gets which threads run the pipeline
+     * @return Execution mode
+     */
+    Public Virtual HttpExecutionMode GetExecutionMode() const = 0;
+
+    /**
+     * @brief Sets which threads run the pipeline; read by StartServer
+     * @param mode Execution mode
+     */
+    Public Virtual Void SetExecutionMode(HttpExecutionMode mode) = 0;
+
+    /**
+     * @brief Gets the core of the network thread in Pinned mode
+     * @return Core index (-1 = no network thread, the caller drives RetrieveRequest)
+     */
+    Public Virtual Int GetNetworkCore() const = 0;
+
+    /**
+     * @brief Sets the core of the network thread in Pinned mode
+     * @param core Core index, wrapped to the core count (-1 = no network thread)
+     */
+    Public Virtual Void SetNetworkCore(CInt core) = 0;
+
+    /**
+     * @brief Gets the core of the first dispatch thread in Pinned mode
+     * @return Core index; worker i runs on (core + i) modulo the core count
+     */
+    Public Virtual UInt GetWorkerCore() const = 0;
+
+    /**
+     * @brief Sets the core of the first dispatch thread in Pinned mode
+     * @param core Core index, wrapped to the core count
+     */
+    Public Virtual Void SetWorkerCore(CUInt core) = 0;
+
+    // ============================================================================
+    // CONNECTIONS
+    // ============================================================================
+
+    /**
+     * @brief Gets the keep-alive idle timeout (advertised in Keep-Alive; idle connections
+     *        are forgotten after it)
+     * @return Timeout in milliseconds
+     */
+    Public Virtual UInt GetKeepAliveTimeoutMs() const = 0;
+
+    /**
+     * @brief Sets the keep-alive idle timeout
+     * @param timeoutMs Timeout in milliseconds (0 is treated as 1)
+     */
+    Public Virtual Void SetKeepAliveTimeoutMs(CUInt timeoutMs) = 0;
+
+    /**
+     * @brief Gets the number of responses sent on one connection before it is closed
+     * @return Request count (0 = keep-alive disabled)
+     */
+    Public Virtual UInt GetKeepAliveMaxRequests() const = 0;
+
+    /**
+     * @brief Sets the number of responses sent on one connection before it is closed
+     * @param count Request count (0 disables keep-alive)
+     */
+    Public Virtual Void SetKeepAliveMaxRequests(CUInt count) = 0;
+};
+
+#endif // I_HTTP_PIPELINE_CONFIG_H
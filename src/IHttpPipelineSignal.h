@@ -0,0 +1,30 @@
+#ifndef I_HTTP_PIPELINE_SIGNAL_H
+#define I_HTTP_PIPELINE_SIGNAL_H
+
+#include <StandardDefines.h>
+
+// Forward declarations
+DefineStandardPointers(IHttpPipelineSignal)
+class IHttpPipelineSignal {
+
+    Public Virtual ~IHttpPipelineSignal() = default;
+
+    // ============================================================================
+    // HTTP PIPELINE SIGNAL OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Signals that new work (a request or a response) entered the pipeline.
+     *        Wakes up a loop blocked in Wait(). Notifications are not lost when nobody waits.
+     */
+    Public Virtual Void Notify() = 0;
+
+    /**
+     * @brief Blocks until Notify() is called or the timeout elapses, then clears the signal
+     * @param timeoutMs Longest time to block in milliseconds
+     * @return true if woken by a notification, false on timeout
+     */
+    Public Virtual Bool Wait(CUInt timeoutMs) = 0;
+};
+
+#endif // I_HTTP_PIPELINE_SIGNAL_H
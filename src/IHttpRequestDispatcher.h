@@ -4,6 +4,9 @@
 #include <StandardDefines.h>
 #include <IHttpRequest.h>
 #include <IHttpResponse.h>
+#include "HttpRoute.h"
+#include "LiteralRouteTable.h"
+#include "HttpRequestArena.h"
 
 DefineStandardPointers(IHttpRequestDispatcher)
 class IHttpRequestDispatcher {
@@ -12,6 +15,49 @@ class IHttpRequestDispatcher {
 
     Public Virtual IHttpResponsePtr DispatchRequest(IHttpRequestPtr request) = 0;
 
+    /**
+     * @brief Dispatch a request, allocating its temporaries from a caller-owned arena
+     * @param request Request to route
+     * @param arena Request-scoped arena, handed to the handler through HttpRequestContext;
+     *        the caller resets or destroys it once the request is done
+     * @return Handler or cached response, or a 304/404/405/500 response
+     */
+    Public Virtual IHttpResponsePtr DispatchRequest(IHttpRequestPtr request, HttpRequestArena& arena) = 0;
+
+    /**
+     * @brief Dispatch by parts, without an IHttpRequest object
+     * @param method Request method
+     * @param url Request path (matched against the route patterns)
+     * @param payload Request body
+     * @param requestId Connection id copied onto the response (may be empty)
+     * @param ifNoneMatch If-None-Match request header (may be empty); answered with 304 Not
+     *        Modified by @Cacheable routes whose cached ETag it matches
+     * @return Handler or cached response, or a 304/404/405/500 response
+     */
+    Public Virtual IHttpResponsePtr Dispatch(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch) = 0;
+
+    /**
+     * @brief Dispatch by parts with a caller-owned request arena (see DispatchRequest())
+     */
+    Public Virtual IHttpResponsePtr Dispatch(HttpMethod method, CStdString& url, CStdString& payload, CStdString& requestId, CStdString& ifNoneMatch, HttpRequestArena& arena) = 0;
+
+    /**
+     * @brief Attach an additional routing table (the generated table is registered on construction)
+     * @param table Routes with static storage duration
+     * @param count Number of entries in table
+     */
+    Public Virtual Void RegisterRoutes(const HttpRoute* table, CSize count) = 0;
+
+    /**
+     * @brief Attach a routing table together with the perfect hash of its literal routes
+     *        (generated by the pre-build)
+     * @param table Routes with static storage duration
+     * @param count Number of entries in table
+     * @param literalIndex Index whose slots point into table; used as-is while it is the
+     *        only table, otherwise the dispatcher rebuilds one index over all tables
+     */
+    Public Virtual Void RegisterRoutes(const HttpRoute* table, CSize count, const LiteralRouteIndex& literalIndex) = 0;
+
 };
 
 #endif // I_HTTP_REQUEST_DISPATCHER_H
\ No newline at end of file
@@ -16,8 +16,13 @@ class IHttpRequestManager {
     // ============================================================================
     
     /**
-     * @brief Retrieves a request from the server and adds it to the queue if available
+     * @brief Runs one iteration of the request loop: retrieves requests from the servers,
+     *        dispatches them and sends the responses. In EventDriven mode (see
+     *        IHttpPipelineConfig) the call only sleeps when the pipeline is idle.
+     *        In Pinned execution with a network core, the network thread runs the
+     *        iterations and this call only waits for GetIdleWaitMs().
      * @return true if a request was retrieved and added to the queue, false otherwise
+     *         (always true in Polling mode)
      */
     Public Virtual Bool RetrieveRequest() = 0;
     
@@ -34,14 +39,15 @@ class IHttpRequestManager {
     Public Virtual Bool ProcessResponse() = 0;
     
     /**
-     * @brief Starts the server
+     * @brief Starts the server. In Pinned execution (see IHttpPipelineConfig) also starts
+     *        the dispatch threads and the network thread on their cores
      * @param port Port number to listen on (default: DEFAULT_SERVER_PORT)
      * @return true if server started successfully, false otherwise
      */
     Public Virtual Bool StartServer(CUInt port = DEFAULT_SERVER_PORT) = 0;
     
     /**
-     * @brief Stops the server
+     * @brief Stops the pinned threads, if any, then the server
      */
     Public Virtual Void StopServer() = 0;
 };
@@ -3,6 +3,7 @@
 
 #include <StandardDefines.h>
 #include <IHttpRequest.h>
+#include <IHttpResponse.h>
 
 // Forward declarations
 DefineStandardPointers(IHttpRequestProcessor)
@@ -15,10 +16,26 @@ class IHttpRequestProcessor {
     // ============================================================================
     
     /**
-     * @brief Processes a request from the queue if available
+     * @brief Processes a request from the queue if available. Thread-safe: several workers
+     *        may call it concurrently; responses of the same requestId keep request order.
      * @return true if a request was processed, false if queue was empty
      */
     Public Virtual Bool ProcessRequest() = 0;
+
+    /**
+     * @brief Reserves the response's place in connection order; called at admission,
+     *        before the request is enqueued
+     * @param requestId Request ID (connection) of the admitted request
+     */
+    Public Virtual Void ReserveResponse(CStdString& requestId) = 0;
+
+    /**
+     * @brief Answers a request that was reserved but not queued (e.g. 503 on a full
+     *        queue). The response goes out after the connection's earlier responses.
+     * @param requestId Request ID (connection) of the rejected request
+     * @param response Response to send in the reserved place
+     */
+    Public Virtual Void RejectRequest(CStdString& requestId, IHttpResponsePtr response) = 0;
 };
 
 #endif // I_HTTP_REQUEST_PROCESSOR_H
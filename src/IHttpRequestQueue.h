@@ -3,6 +3,7 @@
 
 #include <StandardDefines.h>
 #include <IHttpRequest.h>
+#include "HttpQueueStats.h"
 
 // Forward declarations
 DefineStandardPointers(IHttpRequestQueue)
@@ -15,16 +16,32 @@ class IHttpRequestQueue {
     // ============================================================================
     
     /**
-     * @brief Enqueues an HTTP request into the queue
+     * @brief Enqueues an HTTP request into the queue. When the queue is at capacity the
+     *        oldest queued request is dropped to make room.
      * @param request Pointer to the HTTP request to enqueue
      */
     Public Virtual Void EnqueueRequest(IHttpRequestPtr request) = 0;
+
+    /**
+     * @brief Enqueues an HTTP request only if the queue is below capacity
+     * @param request Pointer to the HTTP request to enqueue
+     * @return true if enqueued, false if the queue was full (counted as rejected)
+     */
+    Public Virtual Bool TryEnqueueRequest(IHttpRequestPtr request) = 0;
     
     /**
      * @brief Gets and removes the front HTTP request from the queue
      * @return Pointer to the HTTP request, or nullptr if queue is empty
      */
     Public Virtual IHttpRequestPtr DequeueRequest() = 0;
+
+    /**
+     * @brief Removes the front HTTP request in a single operation, without a separate
+     *        IsEmpty()/HasRequests() check
+     * @param out Receives the request on success, untouched otherwise
+     * @return true if a request was dequeued, false if queue was empty
+     */
+    Public Virtual Bool TryDequeueRequest(IHttpRequestPtr& out) = 0;
     
     /**
      * @brief Check if the queue is empty
@@ -37,6 +54,18 @@ class IHttpRequestQueue {
      * @return true if queue has items, false if empty
      */
     Public Virtual Bool HasRequests() const = 0;
+
+    /**
+     * @brief Check if the queue reached its configured capacity
+     * @return true if no more requests are accepted without dropping one
+     */
+    Public Virtual Bool IsFull() const = 0;
+
+    /**
+     * @brief Snapshot of depth, capacity, high-water mark and drop/reject counters
+     * @return Queue statistics
+     */
+    Public Virtual HttpQueueStats GetStats() const = 0;
 };
 
 #endif // I_HTTP_REQUEST_QUEUE_H
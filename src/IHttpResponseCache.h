@@ -0,0 +1,59 @@
+#ifndef I_HTTP_RESPONSE_CACHE_H
+#define I_HTTP_RESPONSE_CACHE_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+
+// Forward declarations
+DefineStandardPointers(IHttpResponseCache)
+class IHttpResponseCache {
+
+    Public Virtual ~IHttpResponseCache() = default;
+
+    // ============================================================================
+    // RESPONSE CACHE OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Looks up the cached response of a @Cacheable GET route. Expired entries are dropped.
+     * @param path Request path (the cache key, i.e. pattern + variable values)
+     * @param ifNoneMatch Value of the request's If-None-Match header, empty if absent
+     * @return 304 Not Modified if ifNoneMatch matches the cached ETag, otherwise a fresh copy of
+     *         the cached response; nullptr on a miss
+     */
+    Public Virtual IHttpResponsePtr Lookup(CStdString& path, CStdString& ifNoneMatch) = 0;
+
+    /**
+     * @brief Caches a response produced by the controller of a @Cacheable route
+     * @param pattern Route pattern the path matched, for InvalidatePattern()
+     * @param path Request path (the cache key)
+     * @param response Response returned by the controller
+     * @param ttlMs Lifetime in milliseconds, or HttpRouteCacheUntilInvalidated
+     * @return The response to send: a copy carrying an ETag header when it was cached, the
+     *         original response when it was not (non-200 status, body too large)
+     */
+    Public Virtual IHttpResponsePtr Store(CStdString& pattern, CStdString& path, IHttpResponsePtr response, CUInt ttlMs) = 0;
+
+    /**
+     * @brief Drops the cached response of one request path, e.g. "/api/device/info"
+     */
+    Public Virtual Void Invalidate(CStdString& path) = 0;
+
+    /**
+     * @brief Drops the cached responses of every path matched by a route pattern,
+     *        e.g. "/api/device/{id}"
+     */
+    Public Virtual Void InvalidatePattern(CStdString& pattern) = 0;
+
+    /**
+     * @brief Drops every cached response
+     */
+    Public Virtual Void InvalidateAll() = 0;
+
+    /**
+     * @brief Number of cached responses (expired entries included until they are looked up)
+     */
+    Public Virtual Size GetEntryCount() = 0;
+};
+
+#endif // I_HTTP_RESPONSE_CACHE_H
@@ -0,0 +1,30 @@
+#ifndef I_HTTP_RESPONSE_COMPRESSOR_H
+#define I_HTTP_RESPONSE_COMPRESSOR_H
+
+#include <StandardDefines.h>
+#include <IHttpResponse.h>
+
+// Forward declarations
+DefineStandardPointers(IHttpResponseCompressor)
+class IHttpResponseCompressor {
+
+    Public Virtual ~IHttpResponseCompressor() = default;
+
+    // ============================================================================
+    // RESPONSE COMPRESSION OPERATIONS
+    // ============================================================================
+
+    /**
+     * @brief Encodes a response body with the best coding the client accepts
+     * @param response Response produced by a handler or the response cache
+     * @param acceptEncoding Value of the request's Accept-Encoding header, empty if absent
+     * @param resource Request url the response belongs to; encoded bodies are remembered per
+     *        resource and ETag, since handler-chosen ETags need not be unique across routes
+     * @return A gzip/deflate copy carrying Content-Encoding and Vary headers, or the original
+     *         response when the client accepts neither, the body is below
+     *         HTTP_COMPRESSION_MIN_BYTES, it is already encoded, or encoding would not shrink it
+     */
+    Public Virtual IHttpResponsePtr Compress(IHttpResponsePtr response, CStdString& acceptEncoding, CStdString& resource) = 0;
+};
+
+#endif // I_HTTP_RESPONSE_COMPRESSOR_H
@@ -15,9 +15,18 @@ class IHttpResponseProcessor {
     
     /**
      * @brief Processes a response
-     * @return true if a response was processed, false otherwise
+     * @return true if a response was taken off the queue (sent or discarded), false if
+     *         the queue was empty
      */
     Public Virtual Bool ProcessResponse() = 0;
+
+    /**
+     * @brief Takes up to maxCount responses off the queue in one go and sends them
+     * @param maxCount Upper bound of responses handled by this call
+     * @return Number of responses taken off the queue (sent or discarded); less than
+     *         maxCount means the queue was drained
+     */
+    Public Virtual Size ProcessResponses(CSize maxCount) = 0;
 };
 
 #endif // I_HTTP_RESPONSE_PROCESSOR_H
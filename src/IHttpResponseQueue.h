@@ -3,6 +3,7 @@
 
 #include <StandardDefines.h>
 #include <IHttpResponse.h>
+#include "HttpQueueStats.h"
 
 // Forward declarations
 DefineStandardPointers(IHttpResponseQueue)
@@ -16,7 +17,8 @@ class IHttpResponseQueue {
     
     /**
      * @brief Enqueues an HTTP response into the queue. Routes by response->GetRequestSource():
-     *        LocalServer -> local queue, CloudServer -> cloud queue.
+     *        LocalServer -> local queue, CloudServer -> cloud queue. Responses are never
+     *        dropped: a queue may go past its capacity, IsFull() then pauses admission.
      * @param response Pointer to the HTTP response to enqueue
      */
     Public Virtual Void EnqueueResponse(IHttpResponsePtr response) = 0;
@@ -33,6 +35,50 @@ class IHttpResponseQueue {
      */
     Public Virtual IHttpResponsePtr DequeueCloudResponse() = 0;
 
+    /**
+     * @brief Removes the front response of the local queue in a single operation. Thread-safe.
+     * @param out Receives the response on success, untouched otherwise
+     * @return true if a response was dequeued, false if local queue was empty
+     */
+    Public Virtual Bool TryDequeueLocalResponse(IHttpResponsePtr& out) = 0;
+
+    /**
+     * @brief Removes the front response of the cloud queue in a single operation. Thread-safe.
+     * @param out Receives the response on success, untouched otherwise
+     * @return true if a response was dequeued, false if cloud queue was empty
+     */
+    Public Virtual Bool TryDequeueCloudResponse(IHttpResponsePtr& out) = 0;
+
+    /**
+     * @brief Moves up to maxCount responses from the front of the local queue to the end of out.
+     *        Thread-safe.
+     * @param out Vector the responses are appended to, in queue order
+     * @param maxCount Upper bound of responses to take
+     * @return Number of responses appended
+     */
+    Public Virtual Size DequeueLocalResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) = 0;
+
+    /**
+     * @brief Moves up to maxCount responses from the front of the cloud queue to the end of out.
+     *        Thread-safe.
+     * @param out Vector the responses are appended to, in queue order
+     * @param maxCount Upper bound of responses to take
+     * @return Number of responses appended
+     */
+    Public Virtual Size DequeueCloudResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) = 0;
+
+    /**
+     * @brief Snapshot of the local queue's depth, capacity, high-water mark and drops
+     * @return Queue statistics
+     */
+    Public Virtual HttpQueueStats GetLocalStats() const = 0;
+
+    /**
+     * @brief Snapshot of the cloud queue's depth, capacity, high-water mark and drops
+     * @return Queue statistics
+     */
+    Public Virtual HttpQueueStats GetCloudStats() const = 0;
+
     /**
      * @brief Check if the queue is empty
      * @return true if queue is empty, false otherwise
@@ -44,6 +90,13 @@ class IHttpResponseQueue {
      * @return true if queue has items, false if empty
      */
     Public Virtual Bool HasResponses() const = 0;
+
+    /**
+     * @brief Check if the local queue reached its capacity or the cloud queue its
+     *        high-water mark; the request manager admits no requests meanwhile
+     * @return true if either queue is full
+     */
+    Public Virtual Bool IsFull() const = 0;
 };
 
 #endif // I_HTTP_RESPONSE_QUEUE_H
@@ -0,0 +1,271 @@
+#ifndef LITERAL_ROUTE_TABLE_H
+#define LITERAL_ROUTE_TABLE_H
+
+#include <StandardDefines.h>
+#include "HttpRoute.h"
+#include <algorithm>
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Perfect hash of the fully literal routes (no {variable} segment): method + path -> route.
+ *
+ * Two-level hash-and-displace: the FNV-1a hash of the key picks a bucket, and the bucket's
+ * displacement is mixed into the hash to pick the slot. Displacements are chosen so that
+ * no two keys share a slot, so a lookup is one hash, one mix and one compare.
+ *
+ * The pre-build computes the arrays for the generated table
+ * (L4_generate_literal_route_index.py, which must stay in sync with Hash() and Slot()),
+ * so they are constant-initialized and cost no heap or startup time.
+ */
+struct LiteralRouteIndex {
+    UInt32 seed;                      // Mixed into the key hash; retried until one works
+    const UInt16* displacements;      // One per bucket
+    UInt32 bucketMask;                // Bucket count - 1 (power of two)
+    const HttpRoute* const* slots;    // nullptr for free slots
+    UInt32 slotMask;                  // Slot count - 1 (power of two)
+};
+
+/**
+ * Literal route lookup checked before the trie. Only canonical patterns are indexed
+ * ("/a/b": leading slash, no empty segment, no trailing slash); every other request
+ * shape (trailing slash, "//", variables, 405 detection) falls through to the trie,
+ * which holds all routes and defines the matching rules.
+ */
+class LiteralRouteTable {
+    Private
+        static constexpr UInt32 MaxDisplacement = 0xFFFF;
+        static constexpr UInt32 MaxSeeds = 32;
+
+        LiteralRouteIndex index;
+        // Storage of an index built at runtime (empty when a generated index is adopted)
+        StdVector<UInt16> ownedDisplacements;
+        StdVector<const HttpRoute*> ownedSlots;
+
+        static UInt32 NextPowerOfTwo(UInt32 value) {
+            UInt32 result = 1;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        /**
+         * Check whether a pattern is indexed, and compute the path it is stored under
+         * (empty segments removed) so later tables can override it
+         *
+         * @return false for variable patterns and trailing-slash patterns (trie only)
+         */
+        static Bool CanonicalPath(std::string_view pattern, StdString& canonical) {
+            if (pattern.find('{') != std::string_view::npos) {
+                return false;
+            }
+            if (pattern.length() > 1 && pattern.back() == '/') {
+                return false;
+            }
+            canonical.clear();
+            Size start = 0;
+            while (start <= pattern.length()) {
+                Size end = std::min(pattern.find('/', start), pattern.length());
+                if (end > start) {
+                    canonical.push_back('/');
+                    canonical.append(pattern.data() + start, end - start);
+                }
+                start = end + 1;
+            }
+            if (canonical.empty()) {
+                canonical = "/";
+            }
+            return true;
+        }
+
+        /**
+         * Place the keys; false if some bucket found no free displacement
+         */
+        Bool TryBuild(const StdVector<const HttpRoute*>& keys, UInt32 seed, UInt32 bucketCount, UInt32 slotCount) {
+            ownedDisplacements.assign(bucketCount, 0);
+            ownedSlots.assign(slotCount, nullptr);
+
+            StdVector<StdVector<UInt32>> buckets(bucketCount);
+            for (const HttpRoute* route : keys) {
+                UInt32 hash = Hash(seed, HttpMethodIndex(route->method), route->pattern);
+                buckets[hash & (bucketCount - 1)].push_back(hash);
+            }
+            StdVector<UInt32> order(bucketCount);
+            for (UInt32 i = 0; i < bucketCount; i++) {
+                order[i] = i;
+            }
+            // Largest buckets first, while most slots are still free
+            std::stable_sort(order.begin(), order.end(), [&buckets](UInt32 a, UInt32 b) {
+                return buckets[a].size() > buckets[b].size();
+            });
+
+            StdVector<Bool> occupied(slotCount, false);
+            StdVector<UInt32> placed;
+            for (UInt32 bucket : order) {
+                if (buckets[bucket].empty()) {
+                    break;
+                }
+                Bool found = false;
+                for (UInt32 displacement = 0; displacement <= MaxDisplacement && !found; displacement++) {
+                    placed.clear();
+                    found = true;
+                    for (UInt32 hash : buckets[bucket]) {
+                        UInt32 slot = Slot(hash, displacement) & (slotCount - 1);
+                        if (occupied[slot] || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                            found = false;
+                            break;
+                        }
+                        placed.push_back(slot);
+                    }
+                    if (found) {
+                        for (UInt32 slot : placed) {
+                            occupied[slot] = true;
+                        }
+                        ownedDisplacements[bucket] = static_cast<UInt16>(displacement);
+                    }
+                }
+                if (!found) {
+                    return false;
+                }
+            }
+
+            for (const HttpRoute* route : keys) {
+                UInt32 hash = Hash(seed, HttpMethodIndex(route->method), route->pattern);
+                UInt32 slot = Slot(hash, ownedDisplacements[hash & (bucketCount - 1)]) & (slotCount - 1);
+                ownedSlots[slot] = route;
+            }
+            return true;
+        }
+
+    Public
+        LiteralRouteTable() : index{0, nullptr, 0, nullptr, 0} {}
+
+        /**
+         * FNV-1a over the method index byte and the path bytes
+         */
+        static UInt32 Hash(UInt32 seed, CSize methodIndex, std::string_view path) {
+            UInt32 hash = 2166136261u ^ seed;
+            hash = (hash ^ static_cast<UInt32>(methodIndex)) * 16777619u;
+            for (Char c : path) {
+                hash = (hash ^ static_cast<UInt8>(c)) * 16777619u;
+            }
+            return hash;
+        }
+
+        /**
+         * Slot hash of a key in a bucket with the given displacement (murmur3 finalizer)
+         */
+        static UInt32 Slot(UInt32 hash, UInt32 displacement) {
+            hash ^= displacement * 0x9E3779B9u;
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6Bu;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35u;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+        /**
+         * Use an index generated by the pre-build; its arrays must have static storage
+         */
+        Void Adopt(const LiteralRouteIndex& generated) {
+            ownedDisplacements.clear();
+            ownedDisplacements.shrink_to_fit();
+            ownedSlots.clear();
+            ownedSlots.shrink_to_fit();
+            index = generated;
+        }
+
+        /**
+         * Build the index at runtime over several routing tables (or one registered
+         * without a generated index). As in the trie, a later route for the same method
+         * and path replaces an earlier one.
+         *
+         * @param tables Routing tables in registration order
+         * @return false if no perfect hash was found; Find() then always misses
+         */
+        Bool Build(const StdVector<std::pair<const HttpRoute*, Size>>& tables) {
+            Clear();
+
+            StdMap<std::pair<Size, StdString>, const HttpRoute*> latest;
+            StdString canonical;
+            for (const auto& table : tables) {
+                for (Size i = 0; i < table.second; i++) {
+                    const HttpRoute& route = table.first[i];
+                    if (!CanonicalPath(route.pattern, canonical)) {
+                        continue;
+                    }
+                    std::pair<Size, StdString> key(HttpMethodIndex(route.method), canonical);
+                    if (canonical == route.pattern) {
+                        latest[key] = &route;
+                    } else {
+                        // "/a//b" overrides "/a/b" in the trie: leave that path to the trie
+                        latest.erase(key);
+                    }
+                }
+            }
+            if (latest.empty()) {
+                return true;
+            }
+
+            StdVector<const HttpRoute*> keys;
+            keys.reserve(latest.size());
+            for (const auto& entry : latest) {
+                keys.push_back(entry.second);
+            }
+
+            const UInt32 count = static_cast<UInt32>(keys.size());
+            UInt32 bucketCount = NextPowerOfTwo((count + 1) / 2);
+            UInt32 slotCount = NextPowerOfTwo(count + count / 4);
+            for (Int attempt = 0; attempt < 4; attempt++, slotCount <<= 1) {
+                for (UInt32 seed = 0; seed < MaxSeeds; seed++) {
+                    if (TryBuild(keys, seed, bucketCount, slotCount)) {
+                        index = LiteralRouteIndex{seed, ownedDisplacements.data(), bucketCount - 1,
+                                                  ownedSlots.data(), slotCount - 1};
+                        return true;
+                    }
+                }
+            }
+            Clear();
+            return false;
+        }
+
+        /**
+         * Route registered for exactly this method and path, nullptr otherwise
+         * (the caller then asks the trie)
+         */
+        const HttpRoute* Find(HttpMethod method, std::string_view path) const {
+            if (index.slots == nullptr) {
+                return nullptr;
+            }
+            const UInt32 hash = Hash(index.seed, HttpMethodIndex(method), path);
+            const HttpRoute* route = index.slots[Slot(hash, index.displacements[hash & index.bucketMask]) & index.slotMask];
+            if (route != nullptr && route->method == method && path == route->pattern) {
+                return route;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Heap bytes held by a runtime-built index (0 for a generated one)
+         */
+        Size GetMemoryUsage() const {
+            return ownedDisplacements.capacity() * sizeof(UInt16) +
+                   ownedSlots.capacity() * sizeof(const HttpRoute*);
+        }
+
+        Bool IsEmpty() const {
+            return index.slots == nullptr;
+        }
+
+        Void Clear() {
+            index = LiteralRouteIndex{0, nullptr, 0, nullptr, 0};
+            ownedDisplacements.clear();
+            ownedSlots.clear();
+        }
+};
+
+#endif // LITERAL_ROUTE_TABLE_H
@@ -0,0 +1,118 @@
+#include "HttpPipelineDefaults.h"
+
+// Lock-free queue; selected over HttpRequestQueue when HTTP_USE_LOCK_FREE_QUEUES is set
+#if !defined(LOCK_FREE_HTTP_REQUEST_QUEUE_H) && HTTP_USE_LOCK_FREE_QUEUES
+#define LOCK_FREE_HTTP_REQUEST_QUEUE_H
+
+#include "IHttpRequestQueue.h"
+#include "IHttpPipelineSignal.h"
+#include "IHttpPipelineConfig.h"
+#include "MpmcRingBuffer.h"
+#include <atomic>
+
+/* @Component */
+class LockFreeHttpRequestQueue final : public IHttpRequestQueue {
+
+    /* @Autowired */
+    Private IHttpPipelineSignalPtr pipelineSignal;
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
+    // Physical slots are fixed at HTTP_REQUEST_QUEUE_CAPACITY; the configured capacity
+    // can only lower the limit
+    Private MpmcRingBuffer<IHttpRequestPtr> ring;
+    Private std::atomic<Size> highWaterMark;
+    Private std::atomic<Size> droppedCount;
+    Private std::atomic<Size> rejectedCount;
+
+    Public LockFreeHttpRequestQueue()
+        : ring(HTTP_REQUEST_QUEUE_CAPACITY), highWaterMark(0), droppedCount(0), rejectedCount(0) {
+    }
+
+    Public ~LockFreeHttpRequestQueue() override = default;
+
+    // ============================================================================
+    // HTTP Request Queue Operations (lock-free)
+    // ============================================================================
+
+    Public Void EnqueueRequest(IHttpRequestPtr request) override {
+        if (request == nullptr) {
+            return;
+        }
+        CSize capacity = GetCapacity();
+        IHttpRequestPtr evicted;
+        while (ring.ApproximateSize() >= capacity && ring.TryPop(evicted)) {
+            droppedCount.fetch_add(1);
+        }
+        // TryPush only moves from request when it succeeds
+        while (!ring.TryPush(std::move(request))) {
+            if (ring.TryPop(evicted)) {
+                droppedCount.fetch_add(1);
+            }
+        }
+        RecordDepth();
+        pipelineSignal->Notify();
+    }
+
+    // The capacity check and the push are not one atomic step, so concurrent producers
+    // may overshoot the configured limit by at most their count (never the ring size)
+    Public Bool TryEnqueueRequest(IHttpRequestPtr request) override {
+        if (request == nullptr) {
+            return false;
+        }
+        if (ring.ApproximateSize() >= GetCapacity() || !ring.TryPush(std::move(request))) {
+            rejectedCount.fetch_add(1);
+            return false;
+        }
+        RecordDepth();
+        pipelineSignal->Notify();
+        return true;
+    }
+
+    Public IHttpRequestPtr DequeueRequest() override {
+        IHttpRequestPtr request;
+        ring.TryPop(request);
+        return request;
+    }
+
+    Public Bool TryDequeueRequest(IHttpRequestPtr& out) override {
+        return ring.TryPop(out);
+    }
+
+    Public Bool IsEmpty() const override {
+        return ring.IsEmpty();
+    }
+
+    Public Bool HasRequests() const override {
+        return !ring.IsEmpty();
+    }
+
+    Public Bool IsFull() const override {
+        return ring.ApproximateSize() >= GetCapacity();
+    }
+
+    Public HttpQueueStats GetStats() const override {
+        HttpQueueStats stats;
+        stats.depth = ring.ApproximateSize();
+        stats.capacity = GetCapacity();
+        stats.highWaterMark = highWaterMark.load();
+        stats.dropped = droppedCount.load();
+        stats.rejected = rejectedCount.load();
+        return stats;
+    }
+
+    Private Size GetCapacity() const {
+        CSize configured = config->GetRequestQueueCapacity();
+        return configured < ring.GetCapacity() ? configured : ring.GetCapacity();
+    }
+
+    Private Void RecordDepth() {
+        Size depth = ring.ApproximateSize();
+        Size seen = highWaterMark.load();
+        while (depth > seen && !highWaterMark.compare_exchange_weak(seen, depth)) {
+        }
+    }
+};
+
+#endif // LOCK_FREE_HTTP_REQUEST_QUEUE_H
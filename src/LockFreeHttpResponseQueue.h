@@ -0,0 +1,154 @@
+#include "HttpPipelineDefaults.h"
+
+// Lock-free queue; selected over HttpResponseQueue when HTTP_USE_LOCK_FREE_QUEUES is set
+#if !defined(LOCK_FREE_HTTP_RESPONSE_QUEUE_H) && HTTP_USE_LOCK_FREE_QUEUES
+#define LOCK_FREE_HTTP_RESPONSE_QUEUE_H
+
+#include "IHttpResponseQueue.h"
+#include "IHttpPipelineSignal.h"
+#include "IHttpPipelineConfig.h"
+#include "MpmcRingBuffer.h"
+#include <atomic>
+#include <thread>
+
+/* @Component */
+class LockFreeHttpResponseQueue final : public IHttpResponseQueue {
+
+    /* @Autowired */
+    Private IHttpPipelineSignalPtr pipelineSignal;
+
+    /* @Autowired */
+    Private IHttpPipelineConfigPtr config;
+
+    // One bounded ring with its high-water mark. Physical slots are fixed at
+    // HTTP_RESPONSE_QUEUE_SLOTS, room for the responses still produced once the configured
+    // capacity has paused admission; the configured capacity can only lower the limit
+    Private struct BoundedRing {
+        MpmcRingBuffer<IHttpResponsePtr> ring;
+        std::atomic<Size> highWaterMark;
+
+        BoundedRing() : ring(HTTP_RESPONSE_QUEUE_SLOTS), highWaterMark(0) {}
+    };
+
+    Private BoundedRing local;
+    Private BoundedRing cloud;
+
+    Public LockFreeHttpResponseQueue() = default;
+
+    Public ~LockFreeHttpResponseQueue() override = default;
+
+    // ============================================================================
+    // HTTP Response Queue Operations (lock-free)
+    // ============================================================================
+
+    Public Void EnqueueResponse(IHttpResponsePtr response) override {
+        if (response == nullptr) return;
+        RequestSource source = response->GetRequestSource();
+        if (source == RequestSource::LocalServer) {
+            Push(local, std::move(response));
+        } else if (source == RequestSource::CloudServer) {
+            // A slow cloud link pauses admission (IsFull()) instead of losing responses
+            Push(cloud, std::move(response));
+        } else {
+            return;
+        }
+        pipelineSignal->Notify();
+    }
+
+    Public IHttpResponsePtr DequeueLocalResponse() override {
+        IHttpResponsePtr r;
+        local.ring.TryPop(r);
+        return r;
+    }
+
+    Public IHttpResponsePtr DequeueCloudResponse() override {
+        IHttpResponsePtr r;
+        cloud.ring.TryPop(r);
+        return r;
+    }
+
+    Public Bool TryDequeueLocalResponse(IHttpResponsePtr& out) override {
+        return local.ring.TryPop(out);
+    }
+
+    Public Bool TryDequeueCloudResponse(IHttpResponsePtr& out) override {
+        return cloud.ring.TryPop(out);
+    }
+
+    Public Size DequeueLocalResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) override {
+        return PopBatch(local, out, maxCount);
+    }
+
+    Public Size DequeueCloudResponses(StdVector<IHttpResponsePtr>& out, CSize maxCount) override {
+        return PopBatch(cloud, out, maxCount);
+    }
+
+    Public HttpQueueStats GetLocalStats() const override {
+        return Snapshot(local, GetLocalCapacity());
+    }
+
+    Public HttpQueueStats GetCloudStats() const override {
+        return Snapshot(cloud, GetCloudCapacity());
+    }
+
+    Public Bool IsEmpty() const override {
+        return local.ring.IsEmpty() && cloud.ring.IsEmpty();
+    }
+
+    Public Bool HasResponses() const override {
+        return !IsEmpty();
+    }
+
+    Public Bool IsFull() const override {
+        return local.ring.ApproximateSize() >= GetLocalCapacity() || cloud.ring.ApproximateSize() >= GetCloudCapacity();
+    }
+
+    // ============================================================================
+    // Helpers
+    // ============================================================================
+
+    Private Size GetLocalCapacity() const {
+        CSize configured = config->GetResponseQueueCapacity();
+        return configured < HTTP_RESPONSE_QUEUE_CAPACITY ? configured : HTTP_RESPONSE_QUEUE_CAPACITY;
+    }
+
+    Private Size GetCloudCapacity() const {
+        CSize highWater = config->GetCloudResponseHighWaterMark();
+        CSize capacity = GetLocalCapacity();
+        return highWater < capacity ? highWater : capacity;
+    }
+
+    Private Static Void Push(BoundedRing& target, IHttpResponsePtr response) {
+        // TryPush only moves from response when it succeeds. HTTP_RESPONSE_QUEUE_SLOTS
+        // leaves room for every admitted request, so the ring only fills up when that
+        // sizing was overridden; the producer then waits for the sender instead of
+        // dropping a response
+        while (!target.ring.TryPush(std::move(response))) {
+            std::this_thread::yield();
+        }
+        Size depth = target.ring.ApproximateSize();
+        Size seen = target.highWaterMark.load();
+        while (depth > seen && !target.highWaterMark.compare_exchange_weak(seen, depth)) {
+        }
+    }
+
+    Private Static Size PopBatch(BoundedRing& source, StdVector<IHttpResponsePtr>& out, CSize maxCount) {
+        Size taken = 0;
+        IHttpResponsePtr r;
+        while (taken < maxCount && source.ring.TryPop(r)) {
+            out.push_back(std::move(r));
+            taken++;
+        }
+        return taken;
+    }
+
+    Private Static HttpQueueStats Snapshot(const BoundedRing& source, CSize capacity) {
+        HttpQueueStats stats;
+        stats.depth = source.ring.ApproximateSize();
+        stats.capacity = capacity;
+        stats.highWaterMark = source.highWaterMark.load();
+        return stats;
+    }
+};
+
+#endif // LOCK_FREE_HTTP_RESPONSE_QUEUE_H
@@ -0,0 +1,133 @@
+#ifndef MPMC_RING_BUFFER_H
+#define MPMC_RING_BUFFER_H
+
+#include <StandardDefines.h>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * Bounded lock-free multi-producer / multi-consumer ring buffer
+ *
+ * Each cell carries a sequence number that tells producers and consumers whether the
+ * cell is free or filled for their lap, so TryPush/TryPop only need one CAS on the
+ * shared position and never take a lock (D. Vyukov's bounded MPMC queue).
+ *
+ * Capacity is rounded up to a power of two. TryPush fails when the ring is full,
+ * TryPop fails when it is empty; neither blocks.
+ */
+template<typename T>
+class MpmcRingBuffer {
+    Private
+        struct Cell {
+            std::atomic<Size> sequence;
+            T value;
+        };
+
+        // Keep producer and consumer positions on separate cache lines
+        static constexpr Size CacheLineSize = 64;
+
+        Cell* cells;
+        Size mask;
+        alignas(CacheLineSize) std::atomic<Size> enqueuePos;
+        alignas(CacheLineSize) std::atomic<Size> dequeuePos;
+
+        static Size RoundUpToPowerOfTwo(Size value) {
+            Size result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    Public
+        explicit MpmcRingBuffer(Size capacity)
+            : cells(nullptr), mask(0), enqueuePos(0), dequeuePos(0) {
+            Size size = RoundUpToPowerOfTwo(capacity);
+            cells = new Cell[size];
+            mask = size - 1;
+            for (Size i = 0; i < size; i++) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~MpmcRingBuffer() {
+            delete[] cells;
+        }
+
+        MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+        MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+        /**
+         * Push an item
+         * @return false if the ring is full (the item is left untouched)
+         */
+        template<typename U>
+        Bool TryPush(U&& item) {
+            Cell* cell;
+            Size pos = enqueuePos.load(std::memory_order_relaxed);
+            while (true) {
+                cell = &cells[pos & mask];
+                Size seq = cell->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0) {
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // Full
+                } else {
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->value = std::forward<U>(item);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Pop the oldest item
+         * @return false if the ring is empty (out is left untouched)
+         */
+        Bool TryPop(T& out) {
+            Cell* cell;
+            Size pos = dequeuePos.load(std::memory_order_relaxed);
+            while (true) {
+                cell = &cells[pos & mask];
+                Size seq = cell->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0) {
+                    if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // Empty
+                } else {
+                    pos = dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            out = std::move(cell->value);
+            cell->value = T();  // Release held resources (e.g. shared_ptr) right away
+            cell->sequence.store(pos + mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Approximate number of items (exact when no push/pop is in flight)
+         */
+        Size ApproximateSize() const {
+            Size tail = enqueuePos.load(std::memory_order_acquire);
+            Size head = dequeuePos.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        Bool IsEmpty() const {
+            return ApproximateSize() == 0;
+        }
+
+        Size GetCapacity() const {
+            return mask + 1;
+        }
+};
+
+#endif // MPMC_RING_BUFFER_H
@@ -4,6 +4,7 @@
 #include "StandardDefines.h"
 #include "HttpStatus.h"
 #include <NayanSerializer.h>
+#include <utility>
 
 /**
  * ResponseEntity class similar to Spring Boot's ResponseEntity
@@ -37,6 +38,13 @@ public:
         : status_(status), headers_(), body_(body) {
     }
 
+    /**
+     * Constructor with status and body (body is moved in)
+     */
+    ResponseEntity(HttpStatus status, T&& body) 
+        : status_(status), headers_(), body_(std::move(body)) {
+    }
+
     /**
      * Constructor with status, body, and headers
      */
@@ -45,23 +53,19 @@ public:
     }
 
     /**
-     * Copy constructor
+     * Constructor with status, body, and headers (body and headers are moved in)
      */
-    ResponseEntity(const ResponseEntity& other) 
-        : status_(other.status_), headers_(other.headers_), body_(other.body_) {
+    ResponseEntity(HttpStatus status, T&& body, StdMap<StdString, StdString> headers) 
+        : status_(status), headers_(std::move(headers)), body_(std::move(body)) {
     }
 
     /**
-     * Assignment operator
+     * Copy and move are defaulted, so returning an entity by value moves its body
      */
-    ResponseEntity& operator=(const ResponseEntity& other) {
-        if (this != &other) {
-            status_ = other.status_;
-            headers_ = other.headers_;
-            body_ = other.body_;
-        }
-        return *this;
-    }
+    ResponseEntity(const ResponseEntity& other) = default;
+    ResponseEntity(ResponseEntity&& other) = default;
+    ResponseEntity& operator=(const ResponseEntity& other) = default;
+    ResponseEntity& operator=(ResponseEntity&& other) = default;
 
     /**
      * Get the HTTP status code
@@ -91,6 +95,13 @@ public:
         return headers_;
     }
 
+    /**
+     * Get all headers (non-const, e.g. to move them out of an expiring entity)
+     */
+    StdMap<StdString, StdString>& GetHeaders() {
+        return headers_;
+    }
+
     /**
      * Get a specific header value
      */
@@ -148,6 +159,13 @@ public:
         body_ = body;
     }
 
+    /**
+     * Set the body (moved in)
+     */
+    Void SetBody(T&& body) {
+        body_ = std::move(body);
+    }
+
     /**
      * Set the body (fluent/chaining method)
      * Returns reference to self for method chaining
@@ -157,6 +175,15 @@ public:
         return *this;
     }
 
+    /**
+     * Set the body, moved in (fluent/chaining method)
+     * Returns reference to self for method chaining
+     */
+    ResponseEntity<T>& WithBody(T&& body) {
+        body_ = std::move(body);
+        return *this;
+    }
+
     /**
      * Set headers (replaces all existing headers)
      */
@@ -220,6 +247,13 @@ public:
         return ResponseEntity<T>(HttpStatus::OK, body);
     }
 
+    /**
+     * Create ResponseEntity with OK (200) status (body moved in)
+     */
+    Static ResponseEntity<T> Ok(T&& body) {
+        return ResponseEntity<T>(HttpStatus::OK, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with OK (200) status and headers
      */
@@ -227,6 +261,13 @@ public:
         return ResponseEntity<T>(HttpStatus::OK, body, headers);
     }
 
+    /**
+     * Create ResponseEntity with OK (200) status and headers (body moved in)
+     */
+    Static ResponseEntity<T> Ok(T&& body, StdMap<StdString, StdString> headers) {
+        return ResponseEntity<T>(HttpStatus::OK, std::move(body), std::move(headers));
+    }
+
     /**
      * Create ResponseEntity with CREATED (201) status
      */
@@ -234,6 +275,13 @@ public:
         return ResponseEntity<T>(HttpStatus::CREATED, body);
     }
 
+    /**
+     * Create ResponseEntity with CREATED (201) status (body moved in)
+     */
+    Static ResponseEntity<T> Created(T&& body) {
+        return ResponseEntity<T>(HttpStatus::CREATED, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with CREATED (201) status and headers
      */
@@ -241,6 +289,13 @@ public:
         return ResponseEntity<T>(HttpStatus::CREATED, body, headers);
     }
 
+    /**
+     * Create ResponseEntity with CREATED (201) status and headers (body moved in)
+     */
+    Static ResponseEntity<T> Created(T&& body, StdMap<StdString, StdString> headers) {
+        return ResponseEntity<T>(HttpStatus::CREATED, std::move(body), std::move(headers));
+    }
+
     /**
      * Create ResponseEntity with ACCEPTED (202) status
      */
@@ -248,6 +303,13 @@ public:
         return ResponseEntity<T>(HttpStatus::ACCEPTED, body);
     }
 
+    /**
+     * Create ResponseEntity with ACCEPTED (202) status (body moved in)
+     */
+    Static ResponseEntity<T> Accepted(T&& body) {
+        return ResponseEntity<T>(HttpStatus::ACCEPTED, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with NO_CONTENT (204) status
      */
@@ -262,6 +324,13 @@ public:
         return ResponseEntity<T>(HttpStatus::BAD_REQUEST, body);
     }
 
+    /**
+     * Create ResponseEntity with BAD_REQUEST (400) status (body moved in)
+     */
+    Static ResponseEntity<T> BadRequest(T&& body) {
+        return ResponseEntity<T>(HttpStatus::BAD_REQUEST, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with UNAUTHORIZED (401) status
      */
@@ -269,6 +338,13 @@ public:
         return ResponseEntity<T>(HttpStatus::UNAUTHORIZED, body);
     }
 
+    /**
+     * Create ResponseEntity with UNAUTHORIZED (401) status (body moved in)
+     */
+    Static ResponseEntity<T> Unauthorized(T&& body) {
+        return ResponseEntity<T>(HttpStatus::UNAUTHORIZED, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with FORBIDDEN (403) status
      */
@@ -276,6 +352,13 @@ public:
         return ResponseEntity<T>(HttpStatus::FORBIDDEN, body);
     }
 
+    /**
+     * Create ResponseEntity with FORBIDDEN (403) status (body moved in)
+     */
+    Static ResponseEntity<T> Forbidden(T&& body) {
+        return ResponseEntity<T>(HttpStatus::FORBIDDEN, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with NOT_FOUND (404) status
      */
@@ -283,6 +366,13 @@ public:
         return ResponseEntity<T>(HttpStatus::NOT_FOUND, body);
     }
 
+    /**
+     * Create ResponseEntity with NOT_FOUND (404) status (body moved in)
+     */
+    Static ResponseEntity<T> NotFound(T&& body) {
+        return ResponseEntity<T>(HttpStatus::NOT_FOUND, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with METHOD_NOT_ALLOWED (405) status
      */
@@ -290,6 +380,13 @@ public:
         return ResponseEntity<T>(HttpStatus::METHOD_NOT_ALLOWED, body);
     }
 
+    /**
+     * Create ResponseEntity with METHOD_NOT_ALLOWED (405) status (body moved in)
+     */
+    Static ResponseEntity<T> MethodNotAllowed(T&& body) {
+        return ResponseEntity<T>(HttpStatus::METHOD_NOT_ALLOWED, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with CONFLICT (409) status
      */
@@ -297,6 +394,13 @@ public:
         return ResponseEntity<T>(HttpStatus::CONFLICT, body);
     }
 
+    /**
+     * Create ResponseEntity with CONFLICT (409) status (body moved in)
+     */
+    Static ResponseEntity<T> Conflict(T&& body) {
+        return ResponseEntity<T>(HttpStatus::CONFLICT, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with INTERNAL_SERVER_ERROR (500) status
      */
@@ -304,6 +408,13 @@ public:
         return ResponseEntity<T>(HttpStatus::INTERNAL_SERVER_ERROR, body);
     }
 
+    /**
+     * Create ResponseEntity with INTERNAL_SERVER_ERROR (500) status (body moved in)
+     */
+    Static ResponseEntity<T> InternalServerError(T&& body) {
+        return ResponseEntity<T>(HttpStatus::INTERNAL_SERVER_ERROR, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with SERVICE_UNAVAILABLE (503) status
      */
@@ -311,6 +422,13 @@ public:
         return ResponseEntity<T>(HttpStatus::SERVICE_UNAVAILABLE, body);
     }
 
+    /**
+     * Create ResponseEntity with SERVICE_UNAVAILABLE (503) status (body moved in)
+     */
+    Static ResponseEntity<T> ServiceUnavailable(T&& body) {
+        return ResponseEntity<T>(HttpStatus::SERVICE_UNAVAILABLE, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with custom status
      */
@@ -318,12 +436,26 @@ public:
         return ResponseEntity<T>(status, body);
     }
 
+    /**
+     * Create ResponseEntity with custom status (body moved in)
+     */
+    Static ResponseEntity<T> Status(HttpStatus status, T&& body) {
+        return ResponseEntity<T>(status, std::move(body));
+    }
+
     /**
      * Create ResponseEntity with custom status and headers
      */
     Static ResponseEntity<T> Status(HttpStatus status, const T& body, const StdMap<StdString, StdString>& headers) {
         return ResponseEntity<T>(status, body, headers);
     }
+
+    /**
+     * Create ResponseEntity with custom status and headers (body moved in)
+     */
+    Static ResponseEntity<T> Status(HttpStatus status, T&& body, StdMap<StdString, StdString> headers) {
+        return ResponseEntity<T>(status, std::move(body), std::move(headers));
+    }
 };
 
 /**
@@ -370,6 +502,13 @@ public:
         return headers_;
     }
 
+    /**
+     * Get all headers (non-const, e.g. to move them out of an expiring entity)
+     */
+    StdMap<StdString, StdString>& GetHeaders() {
+        return headers_;
+    }
+
     /**
      * Get a specific header value
      */
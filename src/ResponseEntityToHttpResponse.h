@@ -2,10 +2,15 @@
 #define RESPONSEENTITY_TO_HTTPRESPONSE_H
 
 #include "ResponseEntity.h"
+#include "HttpResult.h"
+#include "HttpErrorResponse.h"
 #include "HttpStatus.h"
 #include <IHttpResponse.h>
 #include <SimpleHttpResponse.h>
+#include "HttpResponsePool.h"
 #include <NayanSerializer.h>
+#include <type_traits>
+#include <utility>
 
 /**
  * Utility functions to convert ResponseEntity<T> to IHttpResponse
@@ -46,106 +51,135 @@ namespace ResponseEntityConverter {
     inline constexpr bool is_primitive_type_v = is_primitive_type<T>::value;
 
     /**
-     * Convert ResponseEntity<T> to IHttpResponse (without request ID)
+     * Convert a response body to its wire string
+     * Handles primitive types, strings, and complex types
+     *
+     * @tparam T The type of the body
+     * @param body The body value to convert
+     * @return Serialized body
+     */
+    template<typename T>
+    inline StdString SerializeBody(const T& body) {
+        using namespace nayan::serializer;
+
+        // Check if T is primitive type (includes strings from StandardDefines)
+        if constexpr (is_primitive_type_v<T>) {
+            // Primitive type or string (StdString, CStdString) - convert directly to string
+            return SerializationUtility::Serialize<T>(body);
+        } else if constexpr (std::is_same_v<T, std::string> ||
+                             std::is_same_v<T, const char*> ||
+                             std::is_same_v<T, char*>) {
+            // Standard string types - use as-is
+            return StdString(body);
+        } else {
+            // Complex type - call Serialize() method via SerializationUtility
+            return SerializationUtility::Serialize<T>(body);
+        }
+    }
+
+    /**
+     * Convert a body the caller no longer needs to its wire string
+     * String bodies are already in wire form and are moved instead of copied
+     *
+     * @tparam T The type of the body
+     * @param body The body value to consume (left in a valid but unspecified state)
+     * @return Serialized body
+     */
+    template<typename T>
+    inline StdString ConsumeBody(T& body) {
+        if constexpr (std::is_same_v<T, StdString>) {
+            return std::move(body);
+        } else {
+            return SerializeBody<T>(body);
+        }
+    }
+
+    /**
+     * Convert ResponseEntity<T> to IHttpResponse (with request ID)
      * Handles primitive types, strings, and complex types
-     * Request ID can be set later using SetRequestId() method
      * 
      * @tparam T The type of the response body
+     * @param requestId The unique request ID (GUID) for this response
      * @param entity The ResponseEntity<T> to convert
      * @return IHttpResponsePtr (shared_ptr)
      */
     template<typename T>
-    inline IHttpResponsePtr ToHttpResponse(const ResponseEntity<T>& entity) {
+    inline IHttpResponsePtr ToHttpResponse(CStdString& requestId, const ResponseEntity<T>& entity) {
         // Get status code and message
         HttpStatus status = entity.GetStatus();
         UInt statusCode = StatusToInt(status);
         StdString statusMessage = GetStatusMessage(status);
         
-        // Get headers
-        StdMap<StdString, StdString> headers = entity.GetHeaders();
+        // Get headers (SimpleHttpResponse takes its own copy)
+        const StdMap<StdString, StdString>& headers = entity.GetHeaders();
         
-        // Convert body to string
+        // Convert body to string (Void has no body)
         StdString bodyStr;
-        
-        // Special handling for Void - no body
-        if constexpr (std::is_same_v<T, Void>) {
-            bodyStr = "";
-        } else {
-            // Convert body to string based on type
-            using namespace nayan::serializer;
-            
-            // Check if T is primitive type (includes strings from StandardDefines)
-            if constexpr (is_primitive_type_v<T>) {
-                // Primitive type or string (StdString, CStdString) - convert directly to string
-                bodyStr = SerializationUtility::Serialize<T>(entity.GetBody());
-            } else if constexpr (std::is_same_v<T, std::string> ||
-                                 std::is_same_v<T, const char*> ||
-                                 std::is_same_v<T, char*>) {
-                // Standard string types - use as-is
-                const T& body = entity.GetBody();
-                bodyStr = StdString(body);
-            } else {
-                // Complex type - call Serialize() method via SerializationUtility
-                bodyStr = SerializationUtility::Serialize<T>(entity.GetBody());
-            }
+        if constexpr (!std::is_same_v<T, Void>) {
+            bodyStr = SerializeBody<T>(entity.GetBody());
         }
         
-        // Create SimpleHttpResponse with status, headers, and body (empty requestId)
-        StdString emptyRequestId = "";
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        // Create SimpleHttpResponse with status, headers, and body
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
         return response;
     }
 
     /**
-     * Convert ResponseEntity<T> to IHttpResponse (with request ID)
+     * Convert ResponseEntity<T> to IHttpResponse (without request ID)
      * Handles primitive types, strings, and complex types
+     * Request ID can be set later using SetRequestId() method
      * 
      * @tparam T The type of the response body
-     * @param requestId The unique request ID (GUID) for this response
      * @param entity The ResponseEntity<T> to convert
      * @return IHttpResponsePtr (shared_ptr)
      */
     template<typename T>
-    inline IHttpResponsePtr ToHttpResponse(CStdString& requestId, const ResponseEntity<T>& entity) {
+    inline IHttpResponsePtr ToHttpResponse(const ResponseEntity<T>& entity) {
+        StdString emptyRequestId = "";
+        return ToHttpResponse<T>(emptyRequestId, entity);
+    }
+
+    /**
+     * Convert an expiring ResponseEntity<T> to IHttpResponse (with request ID)
+     * Consumes the entity: string bodies and headers are moved into the response
+     * 
+     * @tparam T The type of the response body
+     * @param requestId The unique request ID (GUID) for this response
+     * @param entity The ResponseEntity<T> to consume
+     * @return IHttpResponsePtr (shared_ptr)
+     */
+    template<typename T>
+    inline IHttpResponsePtr ToHttpResponse(CStdString& requestId, ResponseEntity<T>&& entity) {
         // Get status code and message
         HttpStatus status = entity.GetStatus();
         UInt statusCode = StatusToInt(status);
         StdString statusMessage = GetStatusMessage(status);
         
-        // Get headers
-        StdMap<StdString, StdString> headers = entity.GetHeaders();
-        
-        // Convert body to string
+        // Convert body to string (Void has no body)
         StdString bodyStr;
-        
-        // Special handling for Void - no body
-        if constexpr (std::is_same_v<T, Void>) {
-            bodyStr = "";
-        } else {
-            // Convert body to string based on type
-            using namespace nayan::serializer;
-            
-            // Check if T is primitive type (includes strings from StandardDefines)
-            if constexpr (is_primitive_type_v<T>) {
-                // Primitive type or string (StdString, CStdString) - convert directly to string
-                bodyStr = SerializationUtility::Serialize<T>(entity.GetBody());
-            } else if constexpr (std::is_same_v<T, std::string> ||
-                                 std::is_same_v<T, const char*> ||
-                                 std::is_same_v<T, char*>) {
-                // Standard string types - use as-is
-                const T& body = entity.GetBody();
-                bodyStr = StdString(body);
-            } else {
-                // Complex type - call Serialize() method via SerializationUtility
-                bodyStr = SerializationUtility::Serialize<T>(entity.GetBody());
-            }
+        if constexpr (!std::is_same_v<T, Void>) {
+            bodyStr = ConsumeBody<T>(entity.GetBody());
         }
         
         // Create SimpleHttpResponse with status, headers, and body
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, std::move(entity.GetHeaders()), std::move(bodyStr));
         return response;
     }
 
+    /**
+     * Convert an expiring ResponseEntity<T> to IHttpResponse (without request ID)
+     * Consumes the entity: string bodies and headers are moved into the response
+     * 
+     * @tparam T The type of the response body
+     * @param entity The ResponseEntity<T> to consume
+     * @return IHttpResponsePtr (shared_ptr)
+     */
+    template<typename T>
+    inline IHttpResponsePtr ToHttpResponse(ResponseEntity<T>&& entity) {
+        StdString emptyRequestId = "";
+        return ToHttpResponse<T>(emptyRequestId, std::move(entity));
+    }
+
     /**
      * Overload for ResponseEntity<Void> (no body, without request ID)
      */
@@ -155,15 +189,15 @@ namespace ResponseEntityConverter {
         UInt statusCode = StatusToInt(status);
         StdString statusMessage = GetStatusMessage(status);
         
-        // Get headers
-        StdMap<StdString, StdString> headers = entity.GetHeaders();
+        // Get headers (SimpleHttpResponse takes its own copy)
+        const StdMap<StdString, StdString>& headers = entity.GetHeaders();
         
         // Void has no body
         StdString bodyStr = "";
         
         // Create SimpleHttpResponse with status, headers, and empty body (empty requestId)
         StdString emptyRequestId = "";
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        IHttpResponsePtr response = MakeHttpResponse(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
         return response;
     }
 
@@ -176,17 +210,48 @@ namespace ResponseEntityConverter {
         UInt statusCode = StatusToInt(status);
         StdString statusMessage = GetStatusMessage(status);
         
-        // Get headers
-        StdMap<StdString, StdString> headers = entity.GetHeaders();
+        // Get headers (SimpleHttpResponse takes its own copy)
+        const StdMap<StdString, StdString>& headers = entity.GetHeaders();
         
         // Void has no body
         StdString bodyStr = "";
         
         // Create SimpleHttpResponse with status, headers, and empty body
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
         return response;
     }
 
+    /**
+     * Convert an expiring HttpResult<T> to IHttpResponse (with request ID)
+     * A success is converted like the ResponseEntity<T> it holds; an error becomes a JSON
+     * error body with the error status
+     * 
+     * @tparam T The type of the response body on success
+     * @param requestId The unique request ID (GUID) for this response
+     * @param result The HttpResult<T> to consume
+     * @return IHttpResponsePtr (shared_ptr)
+     */
+    template<typename T>
+    inline IHttpResponsePtr ToHttpResponse(CStdString& requestId, HttpResult<T>&& result) {
+        if (result.IsError()) {
+            return HttpErrorResponse::Create(result.GetStatus(), requestId, result.GetErrorMessage());
+        }
+        if constexpr (std::is_same_v<T, Void>) {
+            return ToHttpResponse(requestId, result.GetEntity());
+        } else {
+            return ToHttpResponse<T>(requestId, std::move(result.GetEntity()));
+        }
+    }
+
+    /**
+     * Convert an expiring HttpResult<T> to IHttpResponse (without request ID)
+     */
+    template<typename T>
+    inline IHttpResponsePtr ToHttpResponse(HttpResult<T>&& result) {
+        StdString emptyRequestId = "";
+        return ToHttpResponse<T>(emptyRequestId, std::move(result));
+    }
+
     /**
      * Create IHttpResponsePtr with 200 OK status from a primitive type or string (without request ID)
      * Handles: int, Int, float, double, bool, Bool, StdString, CStdString, std::string, const char*, char*
@@ -198,25 +263,8 @@ namespace ResponseEntityConverter {
      */
     template<typename T>
     inline IHttpResponsePtr CreateOkResponse(const T& body) {
-        using namespace nayan::serializer;
-        
         // Convert body to string
-        StdString bodyStr;
-        
-        // Check if T is primitive type (includes strings from StandardDefines)
-        if constexpr (is_primitive_type_v<T>) {
-            // Primitive type or string (StdString, CStdString) - convert directly to string
-            bodyStr = SerializationUtility::Serialize<T>(body);
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            // Standard string type
-            bodyStr = StdString(body);
-        } else if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, char*>) {
-            // C-style string
-            bodyStr = StdString(body);
-        } else {
-            // For other types, try to serialize
-            bodyStr = SerializationUtility::Serialize<T>(body);
-        }
+        StdString bodyStr = SerializeBody<T>(body);
         
         // Create SimpleHttpResponse with 200 OK status (empty requestId)
         StdString emptyRequestId = "";
@@ -225,7 +273,7 @@ namespace ResponseEntityConverter {
         StdMap<StdString, StdString> headers;
         headers["Content-Type"] = "application/json";
         
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        IHttpResponsePtr response = MakeHttpResponse(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
         return response;
     }
 
@@ -240,25 +288,32 @@ namespace ResponseEntityConverter {
      */
     template<typename T>
     inline IHttpResponsePtr CreateOkResponse(CStdString& requestId, const T& body) {
-        using namespace nayan::serializer;
-        
         // Convert body to string
-        StdString bodyStr;
+        StdString bodyStr = SerializeBody<T>(body);
         
-        // Check if T is primitive type (includes strings from StandardDefines)
-        if constexpr (is_primitive_type_v<T>) {
-            // Primitive type or string (StdString, CStdString) - convert directly to string
-            bodyStr = SerializationUtility::Serialize<T>(body);
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            // Standard string type
-            bodyStr = StdString(body);
-        } else if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, char*>) {
-            // C-style string
-            bodyStr = StdString(body);
-        } else {
-            // For other types, try to serialize
-            bodyStr = SerializationUtility::Serialize<T>(body);
-        }
+        // Create SimpleHttpResponse with 200 OK status
+        UInt statusCode = 200;
+        StdString statusMessage = "OK";
+        StdMap<StdString, StdString> headers;
+        headers["Content-Type"] = "application/json";
+        
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
+        return response;
+    }
+
+    /**
+     * Create IHttpResponsePtr with 200 OK status from an expiring body (with request ID)
+     * String bodies are moved into the response instead of copied
+     * 
+     * @tparam T The type of the body (primitive, string or serializable type)
+     * @param requestId The unique request ID (GUID) for this response
+     * @param body The body value to consume
+     * @return IHttpResponsePtr with 200 OK status
+     */
+    template<typename T, typename = std::enable_if_t<!std::is_lvalue_reference_v<T>>>
+    inline IHttpResponsePtr CreateOkResponse(CStdString& requestId, T&& body) {
+        // Convert body to string
+        StdString bodyStr = ConsumeBody<T>(body);
         
         // Create SimpleHttpResponse with 200 OK status
         UInt statusCode = 200;
@@ -266,10 +321,24 @@ namespace ResponseEntityConverter {
         StdMap<StdString, StdString> headers;
         headers["Content-Type"] = "application/json";
         
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, bodyStr);
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, std::move(bodyStr));
         return response;
     }
 
+    /**
+     * Create IHttpResponsePtr with 200 OK status from an expiring body (without request ID)
+     * String bodies are moved into the response instead of copied
+     * 
+     * @tparam T The type of the body (primitive, string or serializable type)
+     * @param body The body value to consume
+     * @return IHttpResponsePtr with 200 OK status
+     */
+    template<typename T, typename = std::enable_if_t<!std::is_lvalue_reference_v<T>>>
+    inline IHttpResponsePtr CreateOkResponse(T&& body) {
+        StdString emptyRequestId = "";
+        return CreateOkResponse<T>(emptyRequestId, std::move(body));
+    }
+
     /**
      * Create IHttpResponsePtr with 200 OK status and no body (without request ID)
      * Used for Void responses or when no body is needed
@@ -285,7 +354,7 @@ namespace ResponseEntityConverter {
         StdMap<StdString, StdString> headers;
         StdString emptyBody = "";
         
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, emptyBody);
+        IHttpResponsePtr response = MakeHttpResponse(emptyRequestId, RequestSource::LocalServer, statusCode, statusMessage, headers, emptyBody);
         return response;
     }
 
@@ -303,7 +372,7 @@ namespace ResponseEntityConverter {
         StdMap<StdString, StdString> headers;
         StdString emptyBody = "";
         
-        IHttpResponsePtr response = make_ptr<SimpleHttpResponse>(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, emptyBody);
+        IHttpResponsePtr response = MakeHttpResponse(requestId, RequestSource::LocalServer, statusCode, statusMessage, headers, emptyBody);
         return response;
     }
 